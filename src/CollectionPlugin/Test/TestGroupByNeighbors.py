@@ -0,0 +1,50 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+# Faces selected by their neighbors are found again in the box modified several times:
+# the neighbors of the previous shapes of the box must not be used.
+
+from salome.shaper import model
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 20, 30)
+# the face adjacent to the top one and opposite to the back one is the front face
+Group_1 = model.addGroup(Part_1_doc, "FACE", [model.selection("FACE", "(Box_1_1/Top)(Box_1_1/Back)2")])
+# the face adjacent to the top one and opposite to the right one is the left face
+Group_2 = model.addGroup(Part_1_doc, "FACE", [model.selection("FACE", "(Box_1_1/Top)(Box_1_1/Right)2")])
+model.end()
+
+model.testResultsAreas(Group_1, [20 * 30])
+model.testResultsAreas(Group_2, [10 * 30])
+
+for aDX, aDY, aDZ in [(40, 50, 60), (5, 15, 25), (40, 50, 60)]:
+  model.begin()
+  Box_1.setDimensions(aDX, aDY, aDZ)
+  model.end()
+  assert(Group_1.feature().error() == "")
+  assert(Group_2.feature().error() == "")
+  model.testResultsAreas(Group_1, [aDY * aDZ])
+  model.testResultsAreas(Group_2, [aDX * aDZ])
+
+model.undo()
+model.testResultsAreas(Group_1, [15 * 25])
+model.testResultsAreas(Group_2, [5 * 25])
@@ -0,0 +1,67 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+# Sub-shapes selected by the weak names (sorted sub-shapes of the context are cached)
+# must be the same as the sub-shapes selected by the index of GeomAlgoAPI_NExplode,
+# also when the context is modified.
+
+from salome.shaper import model
+from GeomAPI import GeomAPI_Shape
+
+def selectedShape(theGroup):
+  return theGroup.feature().selectionList("group_list").value(0).value()
+
+def checkWeakNames(thePartDoc, theContext, theType, theShapeType):
+  aNbShapes = theContext.feature().firstResult().shape().subShapes(theShapeType, True).size()
+  assert(aNbShapes > 1)
+  model.begin()
+  aWeakGroups = []
+  anIndexGroups = []
+  for anIndex in range(1, aNbShapes + 1):
+    aWeakName = "_new_weak_name_{}_Cut_1_1".format(anIndex)
+    aWeakGroups.append(model.addGroup(thePartDoc, theType, [model.selection(theType, aWeakName)]))
+    anIndexGroups.append(model.addGroup(thePartDoc, theType, [model.selection(theType, "Cut_1_1", anIndex)]))
+  model.end()
+  for aWeak, anIndexed in zip(aWeakGroups, anIndexGroups):
+    assert(selectedShape(aWeak) is not None)
+    assert(selectedShape(aWeak).isEqual(selectedShape(anIndexed)))
+  model.begin()
+  for aGroup in aWeakGroups + anIndexGroups:
+    thePartDoc.removeFeature(aGroup.feature())
+  model.end()
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Cylinder_1 = model.addCylinder(Part_1_doc, model.selection("VERTEX", "PartSet/Origin"), model.selection("EDGE", "PartSet/OZ"), 3, 20)
+Cut_1 = model.addCut(Part_1_doc, [model.selection("SOLID", "Box_1_1")], [model.selection("SOLID", "Cylinder_1_1")])
+model.end()
+
+checkWeakNames(Part_1_doc, Cut_1, "FACE", GeomAPI_Shape.FACE)
+checkWeakNames(Part_1_doc, Cut_1, "EDGE", GeomAPI_Shape.EDGE)
+
+# the sorted sub-shapes of the previous context must not be used
+model.begin()
+Box_1.setDimensions(20, 15, 10)
+model.end()
+
+checkWeakNames(Part_1_doc, Cut_1, "FACE", GeomAPI_Shape.FACE)
+checkWeakNames(Part_1_doc, Cut_1, "EDGE", GeomAPI_Shape.EDGE)
@@ -20,6 +20,7 @@
 #include <Events_Loop.h>
 #include <Events_MessageGroup.h>
 
+#include <set>
 #include <string>
 #include <cstring>
 
@@ -33,197 +34,322 @@ Events_Loop* Events_Loop::loop()
 Events_ID Events_Loop::eventByName(const char* theName)
 {
   ///! All events created in this session, uniquely identified by the text and char pointer
-  static std::map<std::string, char*> CREATED_EVENTS;
-  char* aResult;
+  static std::map<std::string, std::pair<char*, int> > CREATED_EVENTS;
   std::string aName(theName);
-  std::map<std::string, char*>::iterator aFound = CREATED_EVENTS.find(aName);
+  std::map<std::string, std::pair<char*, int> >::iterator aFound = CREATED_EVENTS.find(aName);
   if (aFound == CREATED_EVENTS.end()) {  //not created yet
 #ifdef WIN32
-    aResult = _strdup(theName);  // copy to make unique internal pointer
+    char* aResult = _strdup(theName);  // copy to make unique internal pointer
 #else
-    aResult = strdup(theName);  // copy to make unique internal pointer
+    char* aResult = strdup(theName);  // copy to make unique internal pointer
 #endif
-    CREATED_EVENTS[aName] = aResult;
-  } else
-    aResult = aFound->second;
+    int aSlot = (int)CREATED_EVENTS.size(); // the next free index in the dispatch tables
+    aFound = CREATED_EVENTS.insert(std::make_pair(aName, std::make_pair(aResult, aSlot))).first;
+  }
+  return Events_ID(aFound->second.first, aFound->second.second);
+}
+
+/// Counts the sending in progress, erases removed registrations when the last one is finished.
+/// Also correct if a listener throws an exception (e.g. Python listener error).
+struct Events_Loop::SendingScope
+{
+  Events_Loop* myLoop; ///< the loop that sends messages
+
+  SendingScope(Events_Loop* theLoop) : myLoop(theLoop) { myLoop->mySendingDepth++; }
+
+  ~SendingScope()
+  {
+    if (--myLoop->mySendingDepth == 0 && !myLoop->myPendingRemovals.empty())
+      myLoop->erasePendingRemovals();
+  }
+};
+
+Events_Loop::Dispatch& Events_Loop::dispatch(const Events_ID& theID)
+{
+  if (theID.mySlot >= (int)myDispatch.size())
+    myDispatch.resize(theID.mySlot + 1);
+  return myDispatch[theID.mySlot];
+}
 
-  return Events_ID(aResult);
+void Events_Loop::updateListeners(Dispatch& theDispatch)
+{
+  if (!theDispatch.myOutdated)
+    return;
+  theDispatch.myOutdated = false;
+  theDispatch.mySenderListeners.clear();
+  theDispatch.myAnyListeners.reset();
+  theDispatch.myAllListeners.reset();
+
+  std::vector<Registration*> anAny;
+  std::map<void*, std::list<Registration*> >::iterator aNULL = theDispatch.myRegistered.find(0);
+  if (aNULL != theDispatch.myRegistered.end())
+    anAny.assign(aNULL->second.begin(), aNULL->second.end());
+  if (!anAny.empty())
+    theDispatch.myAnyListeners = std::make_shared<const std::vector<Registration*> >(anAny);
+
+  // all listeners in order of senders (NULL sender is the first)
+  std::vector<Registration*> anAll;
+  std::set<Events_Listener*> anAllSet;
+  std::map<void*, std::list<Registration*> >::iterator aSender =
+    theDispatch.myRegistered.begin();
+  for(; aSender != theDispatch.myRegistered.end(); aSender++) {
+    std::list<Registration*>::iterator aL = aSender->second.begin();
+    for(; aL != aSender->second.end(); aL++) {
+      if (anAllSet.insert((*aL)->myListener).second)
+        anAll.push_back(*aL);
+    }
+    if (!aSender->first) // NULL sender listeners are stored in myAnyListeners
+      continue;
+    // sender listeners are called before the listeners of all senders
+    std::vector<Registration*> aMerged(aSender->second.begin(), aSender->second.end());
+    aMerged.insert(aMerged.end(), anAny.begin(), anAny.end());
+    theDispatch.mySenderListeners[aSender->first] =
+      std::make_shared<const std::vector<Registration*> >(aMerged);
+  }
+  if (!anAll.empty())
+    theDispatch.myAllListeners = std::make_shared<const std::vector<Registration*> >(anAll);
+}
+
+void Events_Loop::setGroup(Dispatch& theDispatch,
+                           const std::shared_ptr<Events_MessageGroup>& theGroup)
+{
+  if (!theDispatch.myGroup && theGroup)
+    myGroupsNum++;
+  else if (theDispatch.myGroup && !theGroup)
+    myGroupsNum--;
+  theDispatch.myGroup = theGroup;
+  theDispatch.myJoinedNum = 0;
+}
+
+void Events_Loop::setFlushed(Dispatch& theDispatch, const bool theValue)
+{
+  if (theDispatch.myFlushed != theValue) {
+    theDispatch.myFlushed = theValue;
+    myFlushedNum += theValue ? 1 : -1;
+  }
 }
 
 void Events_Loop::sendProcessEvent(const std::shared_ptr<Events_Message>& theMessage,
-  std::list<Events_Listener*>& theListeners, const bool theFlushedNow)
+  const std::vector<Registration*>& theListeners, const bool theFlushedNow)
 {
-  std::list<Events_Listener*>::iterator aL = theListeners.begin();
+  std::vector<Registration*>::const_iterator aL = theListeners.begin();
   for (; aL != theListeners.end(); aL++) {
-    if (theFlushedNow && (*aL)->groupMessages()) {
-      (*aL)->groupWhileFlush(theMessage);
+    if ((*aL)->myRemoved) // removed during this sending
+      continue;
+    Events_Listener* aListener = (*aL)->myListener;
+    if (theFlushedNow && aListener->groupMessages()) {
+      aListener->groupWhileFlush(theMessage);
     } else {
-      (*aL)->processEvent(theMessage);
+      aListener->processEvent(theMessage);
     }
   }
 }
 
 void Events_Loop::send(const std::shared_ptr<Events_Message>& theMessage, bool isGroup)
 {
-  if (myImmediateListeners.find(theMessage->eventID().eventText()) != myImmediateListeners.end()) {
-    myImmediateListeners[theMessage->eventID().eventText()]->processEvent(theMessage);
+  SendingScope aScope(this);
+  Dispatch& aDispatch = dispatch(theMessage->eventID());
+  if (aDispatch.myImmediate) {
+    aDispatch.myImmediate->myListener->processEvent(theMessage);
   }
   // if it is grouped message, just accumulate it
-  bool isFlushedNow = myFlushed.find(theMessage->eventID().myID) != myFlushed.end();
-  if (isGroup && !isFlushedNow) {
+  bool isFlushedNow = aDispatch.myFlushed;
+  if (isGroup && !isFlushedNow && theMessage->isGroup()) {
     std::shared_ptr<Events_MessageGroup> aGroup =
-      std::dynamic_pointer_cast<Events_MessageGroup>(theMessage);
-    if (aGroup) {
-      std::map<char*, std::shared_ptr<Events_Message> >::iterator aMyGroup = myGroups.find(
-          aGroup->eventID().eventText());
-      if (aMyGroup == myGroups.end()) {  // create a new group of messages for accumulation
-        myGroups[aGroup->eventID().eventText()] = aGroup->newEmpty();
-        aMyGroup = myGroups.find(aGroup->eventID().eventText());
-      }
-      std::shared_ptr<Events_MessageGroup> aStored =
-        std::dynamic_pointer_cast<Events_MessageGroup>(aMyGroup->second);
-      aStored->Join(aGroup);
-      return;
-    }
+      std::static_pointer_cast<Events_MessageGroup>(theMessage);
+    if (!aDispatch.myGroup) // create a new group of messages for accumulation
+      setGroup(aDispatch, aGroup->newEmpty());
+    aDispatch.myGroup->Join(aGroup);
+    aDispatch.myJoinedNum++;
+    return;
   }
-  // send
-  std::map<char*, std::map<void*, std::list<Events_Listener*> > >::iterator aFindID =
-    myListeners.find(theMessage->eventID().eventText());
-  if (aFindID != myListeners.end()) {
-    std::map<void*, std::list<Events_Listener*> >::iterator aFindSender = aFindID->second.find(
-        theMessage->sender());
-    if (aFindSender != aFindID->second.end()) {
-      sendProcessEvent(theMessage, aFindSender->second, isFlushedNow && isGroup);
-    }
-    if (theMessage->sender()) {  // also call for NULL senders registered
-      aFindSender = aFindID->second.find(NULL);
-      if (aFindSender != aFindID->second.end()) {
-        sendProcessEvent(theMessage, aFindSender->second, isFlushedNow && isGroup);
-      }
-    }
+  // send; keep the array alive even if listeners are changed during the processing
+  updateListeners(aDispatch);
+  Listeners aListeners = aDispatch.myAnyListeners;
+  if (theMessage->sender()) {
+    std::unordered_map<void*, Listeners>::iterator aFindSender =
+      aDispatch.mySenderListeners.find(theMessage->sender());
+    if (aFindSender != aDispatch.mySenderListeners.end())
+      aListeners = aFindSender->second;
   }
+  if (aListeners)
+    sendProcessEvent(theMessage, *aListeners, isFlushedNow && isGroup);
 }
 
-void Events_Loop::registerListener(Events_Listener* theListener, const Events_ID theID,
-                                   void* theSender, bool theImmediate)
+Events_ListenerToken Events_Loop::registerListener(Events_Listener* theListener,
+  const Events_ID theID, void* theSender, bool theImmediate)
 {
-  if (theImmediate) { // just register as an immediate
-    myImmediateListeners[theID.eventText()] = theListener;
-    return;
-  }
-  std::map<char*, std::map<void*, std::list<Events_Listener*> > >::iterator aFindID =
-    myListeners.find(theID.eventText());
-  if (aFindID == myListeners.end()) {  // create container associated with ID
-    myListeners[theID.eventText()] = std::map<void*, std::list<Events_Listener*> >();
-    aFindID = myListeners.find(theID.eventText());
+  Dispatch& aDispatch = dispatch(theID);
+  if (theImmediate) { // just register as an immediate, only one per event
+    if (aDispatch.myImmediate) {
+      if (aDispatch.myImmediate->myListener == theListener)
+        return aDispatch.myImmediate->myToken;
+      removeListener(aDispatch.myImmediate->myToken);
+    }
+  } else {
+    // check that listener was not registered with such parameters before
+    std::map<void*, std::list<Registration*> >::iterator aFindSender =
+      aDispatch.myRegistered.find(theSender);
+    if (aFindSender != aDispatch.myRegistered.end()) {
+      std::list<Registration*>::iterator aL = aFindSender->second.begin();
+      for (; aL != aFindSender->second.end(); aL++)
+        if ((*aL)->myListener == theListener && !(*aL)->myRemoved)
+          return (*aL)->myToken;  // avoid duplicates
+    }
   }
 
-  std::map<void*, std::list<Events_Listener*> >::iterator aFindSender =
-    aFindID->second.find(theSender);
-  if (aFindSender == aFindID->second.end()) {  // create container associated with sender
-    aFindID->second[theSender] = std::list<Events_Listener*>();
-    aFindSender = aFindID->second.find(theSender);
+  Events_ListenerToken aToken = ++myLastToken;
+  Registration& aReg = myRegistrations[aToken];
+  aReg.myToken = aToken;
+  aReg.myListener = theListener;
+  aReg.mySlot = theID.mySlot;
+  aReg.mySender = theSender;
+  aReg.myImmediate = theImmediate;
+  aReg.myRemoved = false;
+  std::list<Events_ListenerToken>& aTokens = myListenerTokens[theListener];
+  aReg.myListenerPos = aTokens.insert(aTokens.end(), aToken);
+  if (theImmediate) {
+    aDispatch.myImmediate = &aReg;
+  } else {
+    std::list<Registration*>& aListeners = aDispatch.myRegistered[theSender];
+    aReg.mySenderPos = aListeners.insert(aListeners.end(), &aReg);
+    aDispatch.myOutdated = true;
   }
-  // check that listener was not registered with such parameters before
-  std::list<Events_Listener*>& aListeners = aFindSender->second;
-  for (std::list<Events_Listener*>::iterator aL = aListeners.begin(); aL != aListeners.end(); aL++)
-    if (*aL == theListener)
-      return;  // avoid duplicates
-
-  aListeners.push_back(theListener);
+  return aToken;
 }
 
 void Events_Loop::removeListener(Events_Listener* theListener)
 {
-  // remove the listener in myListeners map
-  std::map<char*, std::map<void*, std::list<Events_Listener*> > >::const_reverse_iterator
-                                                          anIt = myListeners.rbegin();
-  while(anIt != myListeners.rend()) {
-    std::map<void*, std::list<Events_Listener*> > aLMap = anIt->second;
-    std::map<void*, std::list<Events_Listener*> >::const_reverse_iterator aLIt = aLMap.rbegin();
-    while (aLIt != aLMap.rend()) {
-      std::list<Events_Listener*> aListeners = aLIt->second;
-      std::list<Events_Listener*>::const_reverse_iterator aLsIt = aListeners.rbegin();
-      for (; aLsIt != aListeners.rend(); aLsIt++) {
-        if (*aLsIt == theListener) {
-          aListeners.remove(theListener);
-          aLMap[aLIt->first] = aListeners;
-          myListeners[anIt->first] = aLMap;
-          break;
-        }
-      }
-      if (aListeners.empty()) {
-        aLMap.erase(aLIt->first);
-        myListeners[anIt->first] = aLMap;
-        if (aLMap.empty())
-          break; // avoid incrementation of the iterator if the container is empty
-      }
-      aLIt++;
-    }
-    if (anIt->second.empty()) {
-      myListeners.erase(anIt->first);
-      if (myListeners.empty())
-        break; // avoid incrementation of the iterator if the container is empty
-    }
-    anIt++;
-  }
+  std::unordered_map<Events_Listener*, std::list<Events_ListenerToken> >::iterator aFound =
+    myListenerTokens.find(theListener);
+  if (aFound == myListenerTokens.end())
+    return;
+  // copy: each removal erases its token from the list of the listener
+  std::vector<Events_ListenerToken> aTokens(aFound->second.begin(), aFound->second.end());
+  std::vector<Events_ListenerToken>::iterator aToken = aTokens.begin();
+  for(; aToken != aTokens.end(); aToken++)
+    removeListener(*aToken);
+}
 
-  // remove the listener in myImmediateListeners map
-  std::map<char*, Events_Listener*>::const_reverse_iterator anImIt = myImmediateListeners.rbegin();
-  while(anImIt != myImmediateListeners.rend()) {
-    if (anImIt->second == theListener) {
-      myImmediateListeners.erase(anImIt->first);
-      if (myImmediateListeners.empty())
-        break; // avoid incrementation of the iterator if the container is empty
-    }
-    anImIt++;
+void Events_Loop::removeListener(const Events_ListenerToken theToken)
+{
+  std::unordered_map<Events_ListenerToken, Registration>::iterator aFound =
+    myRegistrations.find(theToken);
+  if (aFound == myRegistrations.end() || aFound->second.myRemoved)
+    return;
+  Registration& aReg = aFound->second;
+  aReg.myRemoved = true;
+  // the listener must not be called anymore
+  Dispatch& aDispatch = myDispatch[aReg.mySlot];
+  if (aReg.myImmediate && aDispatch.myImmediate == &aReg)
+    aDispatch.myImmediate = 0;
+  // forget the token in the listener tokens
+  std::unordered_map<Events_Listener*, std::list<Events_ListenerToken> >::iterator aTokens =
+    myListenerTokens.find(aReg.myListener);
+  aTokens->second.erase(aReg.myListenerPos);
+  if (aTokens->second.empty())
+    myListenerTokens.erase(aTokens);
+  if (mySendingDepth) // arrays of listeners may be iterated now, so, erase it later
+    myPendingRemovals.push_back(theToken);
+  else
+    eraseRegistration(theToken);
+}
+
+void Events_Loop::eraseRegistration(const Events_ListenerToken theToken)
+{
+  std::unordered_map<Events_ListenerToken, Registration>::iterator aFound =
+    myRegistrations.find(theToken);
+  Registration& aReg = aFound->second;
+  if (!aReg.myImmediate) {
+    Dispatch& aDispatch = myDispatch[aReg.mySlot];
+    std::map<void*, std::list<Registration*> >::iterator aSender =
+      aDispatch.myRegistered.find(aReg.mySender);
+    aSender->second.erase(aReg.mySenderPos);
+    if (aSender->second.empty())
+      aDispatch.myRegistered.erase(aSender);
+    // flat arrays are recomputed before the next sending, so, they never refer erased one
+    aDispatch.myOutdated = true;
   }
+  myRegistrations.erase(aFound);
+}
+
+void Events_Loop::erasePendingRemovals()
+{
+  std::vector<Events_ListenerToken> aRemovals;
+  aRemovals.swap(myPendingRemovals);
+  std::vector<Events_ListenerToken>::iterator aToken = aRemovals.begin();
+  for(; aToken != aRemovals.end(); aToken++)
+    eraseRegistration(*aToken);
 }
 
 void Events_Loop::flush(const Events_ID& theID)
 {
   if (!myFlushActive)
     return;
-  bool hasEventsToFlush = !myGroups.empty();
-  std::map<char*, std::shared_ptr<Events_Message> >::iterator aMyGroup;
-  for(aMyGroup = myGroups.find(theID.eventText());
-    aMyGroup != myGroups.end(); aMyGroup = myGroups.find(theID.eventText()))
-  {  // really sends
-    bool aWasFlushed = myFlushed.find(theID.myID) != myFlushed.end();
+  SendingScope aScope(this);
+  bool hasEventsToFlush = myGroupsNum != 0;
+  Dispatch& aDispatch = dispatch(theID);
+  while(aDispatch.myGroup) {  // really sends
+    bool aWasFlushed = aDispatch.myFlushed;
     if (!aWasFlushed)
-      myFlushed.insert(theID.myID);
-    std::shared_ptr<Events_Message> aGroup = aMyGroup->second;
-    myGroups.erase(aMyGroup);
+      setFlushed(aDispatch, true);
+    std::shared_ptr<Events_Message> aGroup = aDispatch.myGroup;
+    if (aDispatch.myJoinedNum > 1)
+      myCoalescedNum += aDispatch.myJoinedNum - 1;
+    setGroup(aDispatch, std::shared_ptr<Events_MessageGroup>());
     send(aGroup, false);
 
-    if (!aWasFlushed) {
-      // TODO: Stabilization fix. Check later.
-      if(myFlushed.find(theID.myID) != myFlushed.end()) {
-        myFlushed.erase(myFlushed.find(theID.myID));
-      }
-#ifdef _DEBUG
-      else {
-        bool aProblem = true;
-      }
-#endif
-    }
+    if (!aWasFlushed)
+      setFlushed(aDispatch, false);
     // send accumulated messages to "groupListeners"
-    std::map<char*, std::map<void*, std::list<Events_Listener*> > >::iterator aFindID =
-      myListeners.find(theID.eventText());
-    if (aFindID != myListeners.end()) {
-      std::map<void*, std::list<Events_Listener*> >::iterator aFindSender =
-        aFindID->second.begin();
-      for(; aFindSender != aFindID->second.end(); aFindSender++) {
-        std::list<Events_Listener*>::iterator aListener = aFindSender->second.begin();
-        for(; aListener != aFindSender->second.end(); aListener++) {
-          if ((*aListener)->groupMessages()) {
-            (*aListener)->flushGrouped(theID);
-          }
+    updateListeners(aDispatch);
+    Listeners aListeners = aDispatch.myAllListeners;
+    if (aListeners) {
+      std::vector<Registration*>::const_iterator aL = aListeners->begin();
+      for(; aL != aListeners->end(); aL++) {
+        if (!(*aL)->myRemoved && (*aL)->myListener->groupMessages()) {
+          (*aL)->myListener->flushGrouped(theID);
         }
       }
     }
   }
-  if (hasEventsToFlush && myGroups.empty() && myFlushed.empty()) {
+  if (!myFlushAllDepth) // otherwise it is done once in the end of flushAll
+    finishFlush(hasEventsToFlush);
+}
+
+void Events_Loop::setFlushOrder(const std::list<Events_ID>& theOrder)
+{
+  myFlushOrder.assign(theOrder.begin(), theOrder.end());
+}
+
+int Events_Loop::flushAll()
+{
+  if (!myFlushActive)
+    return 0;
+  SendingScope aScope(this);
+  myFlushAllDepth++;
+  int aCoalesced = myCoalescedNum;
+  bool hasEventsToFlush = myGroupsNum != 0;
+  size_t anIndex = 0; // by index: the order may be changed by listeners
+  while(anIndex < myFlushOrder.size() && myFlushActive) {
+    Events_ID anID = myFlushOrder[anIndex];
+    if (hasGrouppedEvent(anID)) {
+      flush(anID);
+      // listeners may produce messages of the previous events (not declared dependency)
+      anIndex = 0;
+    } else {
+      anIndex++;
+    }
+  }
+  myFlushAllDepth--;
+  if (!myFlushAllDepth)
+    finishFlush(hasEventsToFlush);
+  return myCoalescedNum - aCoalesced;
+}
+
+void Events_Loop::finishFlush(const bool theHadEventsToFlush)
+{
+  if (theHadEventsToFlush && myGroupsNum == 0 && myFlushedNum == 0) {
     // no more messages left in the queue, so, finalize the sketch processing
     static Events_ID anID = Events_Loop::eventByName("SketchPrepared");
     std::shared_ptr<Events_Message> aMsg(new Events_Message(anID, this));
@@ -233,11 +359,8 @@ void Events_Loop::flush(const Events_ID& theID)
 
 void Events_Loop::eraseMessages(const Events_ID& theID)
 {
-  std::map<char*, std::shared_ptr<Events_Message> >::iterator aMyGroup =
-    myGroups.find(theID.eventText());
-  if (aMyGroup != myGroups.end()) {
-    myGroups.erase(aMyGroup);
-  }
+  if (theID.mySlot < (int)myDispatch.size())
+    setGroup(myDispatch[theID.mySlot], std::shared_ptr<Events_MessageGroup>());
 }
 
 
@@ -250,27 +373,21 @@ bool Events_Loop::activateFlushes(const bool theActivate)
 
 void Events_Loop::clear(const Events_ID& theID)
 {
-  std::map<char*, std::shared_ptr<Events_Message>>::iterator aMyGroup =
-    myGroups.find(theID.eventText());
-  if (aMyGroup != myGroups.end()) {  // really sends
-    myGroups.erase(aMyGroup);
-  }
+  if (theID.mySlot < (int)myDispatch.size())
+    setGroup(myDispatch[theID.mySlot], std::shared_ptr<Events_MessageGroup>());
 }
 
 bool Events_Loop::isFlushed(const Events_ID& theID)
 {
-  return myFlushed.find(theID.myID) != myFlushed.end();
+  return theID.mySlot < (int)myDispatch.size() && myDispatch[theID.mySlot].myFlushed;
 }
 
 void Events_Loop::setFlushed(const Events_ID& theID, const bool theValue)
 {
-  if (theValue)
-    myFlushed.insert(theID.myID);
-  else
-    myFlushed.erase(myFlushed.find(theID.myID));
+  setFlushed(dispatch(theID), theValue);
 }
 
 bool Events_Loop::hasGrouppedEvent(const Events_ID& theID)
 {
-  return myGroups.find(theID.myID) != myGroups.end();
-}
\ No newline at end of file
+  return theID.mySlot < (int)myDispatch.size() && myDispatch[theID.mySlot].myGroup;
+}
@@ -24,11 +24,16 @@
 #include <Events_Listener.h>
 
 #include <map>
-#include <set>
 #include <list>
+#include <deque>
+#include <vector>
+#include <unordered_map>
 
 class Events_MessageGroup;
 
+/// Identifier of one registration of a listener in the loop, allows to remove it in O(1)
+typedef size_t Events_ListenerToken;
+
 /**\class Events_Loop
  * \ingroup EventsLoop
  * \brief Base class that manages the receiving and sending of all
@@ -41,23 +46,91 @@ class Events_MessageGroup;
  */
 class Events_Loop
 {
-  /// map from event ID to sender pointer to listeners that must be called for this
-  std::map<char*, std::map<void*, std::list<Events_Listener*> > > myListeners;
-
-  /// map from event ID to listeners which must process message without waiting for flush
-  std::map<char*, Events_Listener*> myImmediateListeners;
-
-  /// map from event ID to groupped messages (accumulated for flush)
-  std::map<char*, std::shared_ptr<Events_Message> > myGroups;
-
-  ///< set of messages that are flushed right now, so they are not grouped
-  std::set<char*> myFlushed;
+  /// One registration of a listener: the event, the sender and the place in the containers
+  struct Registration
+  {
+    Events_ListenerToken myToken; ///< identifier of this registration
+    Events_Listener* myListener;  ///< the registered listener
+    int mySlot;                   ///< slot of the event ID
+    void* mySender;               ///< listen only for this sender (NULL - listen everybody)
+    bool myImmediate;             ///< the listener does not wait for flush
+    bool myRemoved;               ///< removed, but still may be referenced by the sending
+    /// position in the dispatch record list of the sender
+    std::list<Registration*>::iterator mySenderPos;
+    /// position in the tokens list of the listener
+    std::list<Events_ListenerToken>::iterator myListenerPos;
+  };
+
+  /// flat array of listeners, shared with the sending in progress (copy-on-write)
+  typedef std::shared_ptr<const std::vector<Registration*> > Listeners;
+
+  /// Dispatch record of one event ID: all the loop needs to deliver the message of this kind.
+  struct Dispatch
+  {
+    /// sender pointer to listeners registered for this sender (NULL - listen everybody)
+    std::map<void*, std::list<Registration*> > myRegistered;
+    /// precomputed listeners per not-NULL sender: the sender ones, then the NULL-sender ones
+    std::unordered_map<void*, Listeners> mySenderListeners;
+    /// listeners for NULL sender only (for senders that have no own listeners)
+    Listeners myAnyListeners;
+    /// all distinct listeners of this event (to send grouped messages on flush)
+    Listeners myAllListeners;
+    /// the flat arrays must be recomputed from myRegistered before the next sending
+    bool myOutdated;
+    /// listener which must process message without waiting for flush
+    Registration* myImmediate;
+    /// groupped messages (accumulated for flush)
+    std::shared_ptr<Events_MessageGroup> myGroup;
+    /// number of messages joined into myGroup
+    int myJoinedNum;
+    /// the message is flushed right now, so it is not grouped
+    bool myFlushed;
+
+    Dispatch() : myOutdated(false), myImmediate(0), myJoinedNum(0), myFlushed(false) {}
+  };
+
+  /// dispatch records indexed by the event ID slot (deque keeps references valid on growth)
+  std::deque<Dispatch> myDispatch;
+
+  /// all registrations by tokens (references to elements are stable)
+  std::unordered_map<Events_ListenerToken, Registration> myRegistrations;
+
+  /// tokens of registrations of each listener
+  std::unordered_map<Events_Listener*, std::list<Events_ListenerToken> > myListenerTokens;
+
+  /// the last given token
+  Events_ListenerToken myLastToken;
+
+  /// registrations removed while sending: they are erased when the sending is finished
+  std::vector<Events_ListenerToken> myPendingRemovals;
+
+  /// number of the sendings and flushes in progress
+  int mySendingDepth;
+
+  /// number of events that have groupped messages
+  int myGroupsNum;
+
+  /// number of events that are flushed right now
+  int myFlushedNum;
+
+  /// events flushed by flushAll, in the order of dependencies
+  std::vector<Events_ID> myFlushOrder;
+
+  /// number of flushAll in progress: the end of flush is notified once, by the upper one
+  int myFlushAllDepth;
+
+  /// total number of messages that were joined to already accumulated groups and flushed
+  int myCoalescedNum;
 
   /// to process flushes or not
   bool myFlushActive;
 
   //! The empty constructor, will be called at startup of the application, only once
-  Events_Loop() : myFlushActive(true) {}
+  Events_Loop() : myLastToken(0), mySendingDepth(0), myGroupsNum(0), myFlushedNum(0),
+    myFlushAllDepth(0), myCoalescedNum(0), myFlushActive(true) {}
+
+  /// Counts the sending in progress to postpone erasing of the removed registrations
+  struct SendingScope;
 
  public:
   ///! Returns the main object of the loop, one per application.
@@ -77,16 +150,37 @@ class Events_Loop
   //! \param theID listen for messages with this ID
   //! \param theSender listen only for this sender (NULL - listen everybody)
   //! \param theImmediate for listeners who can not wait (no groupping mechanism is used for it)
-  EVENTS_EXPORT void registerListener(Events_Listener* theListener, const Events_ID theID,
-    void* theSender = 0, bool theImmediate = false);
+  //! \returns token of the registration that allows to remove it
+  EVENTS_EXPORT Events_ListenerToken registerListener(Events_Listener* theListener,
+    const Events_ID theID, void* theSender = 0, bool theImmediate = false);
 
   //! Remove the listener from internal maps if it was registered there
   //! \param theListener a listener
   EVENTS_EXPORT void removeListener(Events_Listener* theListener);
 
+  //! Removes one registration of a listener. If some message is sent right now, the listener
+  //! is not called anymore, but the internal containers are cleaned only when sending is finished.
+  //! \param theToken the value returned by registerListener
+  EVENTS_EXPORT void removeListener(const Events_ListenerToken theToken);
+
   //! Initializes sending of a group-message by the given ID
   EVENTS_EXPORT void flush(const Events_ID& theID);
 
+  //! Declares events flushed by flushAll in the order of their dependencies: listeners
+  //! of an event may produce messages of the next events, but not of the previous ones
+  EVENTS_EXPORT void setFlushOrder(const std::list<Events_ID>& theOrder);
+
+  //! Flushes all accumulated messages of events declared by setFlushOrder in one pass:
+  //! each time the first event in the order that has messages is flushed, so, messages
+  //! produced by listeners are joined to the accumulated groups and sent only once.
+  //! \returns number of messages joined to already accumulated groups of the flushed events
+  //! (duplicates among them are merged by Join of the group, e.g. the set of updated objects)
+  EVENTS_EXPORT int flushAll();
+
+  //! Returns the total number of messages joined to already accumulated groups and flushed
+  //! since the application start (by flush and flushAll)
+  EVENTS_EXPORT int coalescedMessages() const { return myCoalescedNum; }
+
   //! Removes messages with the given ID: they are not needed anymore (UPDATE on close)
   EVENTS_EXPORT void eraseMessages(const Events_ID& theID);
 
@@ -111,8 +205,28 @@ private:
   //! Calls "processEvent" for the given listeners.
   //! If theFlushedNow for grouped listeners is stores message in listeners.
   void sendProcessEvent(const std::shared_ptr<Events_Message>& theMessage,
-    std::list<Events_Listener*>& theListeners, const bool theFlushedNow);
+    const std::vector<Registration*>& theListeners, const bool theFlushedNow);
+
+  //! Returns the dispatch record of the event, creates it if needed
+  Dispatch& dispatch(const Events_ID& theID);
+
+  //! Recomputes the flat listeners arrays of the record if registrations were changed
+  static void updateListeners(Dispatch& theDispatch);
+
+  //! Erases the removed registration from all containers
+  void eraseRegistration(const Events_ListenerToken theToken);
+
+  //! Erases registrations removed during the sending, called when sending is finished
+  void erasePendingRemovals();
+
+  //! Stores the groupped message of the event or removes it if theGroup is empty
+  void setGroup(Dispatch& theDispatch, const std::shared_ptr<Events_MessageGroup>& theGroup);
+
+  //! Sets the "flushed right now" state of the event
+  void setFlushed(Dispatch& theDispatch, const bool theValue);
 
+  //! Sends "SketchPrepared" if all the accumulated messages were flushed
+  void finishFlush(const bool theHadEventsToFlush);
 };
 
 #endif
@@ -30,16 +30,20 @@
  * that stores correspondence between the string-name of the
  * identifier and the pointer to the static string that is really
  * used as an identifier (this is useful for debugging of the events
- * with log files and in debugger).
+ * with log files and in debugger). Each identifier also gets a small
+ * integer slot that indexes the dispatch tables of the loop directly.
  */
 class EVENTS_EXPORT Events_ID
 {
   /// pointer to the text-identifier of the event, unique pointer for all events of such type
   char* myID;
+  /// index of the event in the dispatch tables of the loop, unique for all events of such type
+  int mySlot;
 
-  Events_ID(char* theID)
+  Events_ID(char* theID, const int theSlot)
   {
     myID = theID;
+    mySlot = theSlot;
   }
 
   friend class Events_Loop;
@@ -66,12 +70,16 @@ class EVENTS_EXPORT Events_Message
   Events_ID myEventsId;  ///< identifier of the event
   void* mySender;  ///< the sender object
 
+ protected:
+  bool myIsGroup;  ///< true if the message is an Events_MessageGroup (avoids dynamic casts)
+
  public:
 
   //! Creates the message
   Events_Message(const Events_ID theID, const void* theSender = 0)
       : myEventsId(theID),
-        mySender((void*) theSender)
+        mySender((void*) theSender),
+        myIsGroup(false)
   {
   }
   //! do nothing in the destructor yet
@@ -90,6 +98,12 @@ class EVENTS_EXPORT Events_Message
   {
     return mySender;
   }
+
+  //! Returns true if the message may be grouped by the loop (it is an Events_MessageGroup)
+  bool isGroup() const
+  {
+    return myIsGroup;
+  }
 };
 
 #endif
@@ -21,7 +21,9 @@
 
 Events_MessageGroup::Events_MessageGroup(const Events_ID theID, const void* theSender)
 : Events_Message(theID, theSender)
-{}
+{
+  myIsGroup = true;
+}
 
 Events_MessageGroup::~Events_MessageGroup()
 {}
@@ -68,6 +68,10 @@
 
 #include <XAO_Group.hxx>
 #include <XAO_Field.hxx>
+#include <XAO_BooleanStep.hxx>
+#include <XAO_IntegerStep.hxx>
+#include <XAO_DoubleStep.hxx>
+#include <XAO_StringStep.hxx>
 #include <XAO_Xao.hxx>
 #include <XAO_Geometry.hxx>
 
@@ -281,26 +285,15 @@ void ExchangePlugin_ExportFeature::exportFile(const std::string& theFileName,
   }
 }
 
-/// Returns XAO string by the value from the table
-static std::string valToString(const ModelAPI_AttributeTables::Value& theVal,
-                               const ModelAPI_AttributeTables::ValueType& theType)
+/// Sets all values of the XAO step from the values of the table, element by element
+template<typename TYPE, typename STEP>
+static void setStepValues(STEP* theStep, TYPE ModelAPI_AttributeTables::Value::* theMember,
+                          const std::vector<ModelAPI_AttributeTables::Value>& theValues)
 {
-  std::ostringstream aStr; // the resulting string value
-  switch(theType) {
-  case ModelAPI_AttributeTables::BOOLEAN:
-    aStr<<(theVal.myBool ? "true" : "false");
-    break;
-  case ModelAPI_AttributeTables::INTEGER:
-    aStr<<theVal.myInt;
-    break;
-  case ModelAPI_AttributeTables::DOUBLE:
-    aStr<<theVal.myDouble;
-    break;
-  case ModelAPI_AttributeTables::STRING:
-    aStr<<theVal.myStr;
-    break;
-  }
-  return aStr.str();
+  std::vector<TYPE> aValues(theValues.size());
+  for (size_t anIndex = 0; anIndex < theValues.size(); ++anIndex)
+    aValues[anIndex] = theValues[anIndex].*theMember;
+  theStep->setValues(aValues);
 }
 
 void ExchangePlugin_ExportFeature::exportSTL(const std::string& theFileName)
@@ -558,49 +551,51 @@ void ExchangePlugin_ExportFeature::exportXAO(const std::string& theFileName,
           aStep->setStep(aStepIndex + 1);
           int aStampIndex = aStamps->value(aStepIndex);
           aStep->setStamp(aStampIndex);
-          int aNumElements = isWholePart ? aXaoField->countElements() : aTables->rows();
+          int aNumElements = aXaoField->countElements();
           int aNumComps = aTables->columns();
-          std::set<int> aFilledIDs; // to fill the rest by defaults
+          // values of the step element by element, the first row of tables keeps the defaults
+          std::vector<ModelAPI_AttributeTables::Value> aValues(aNumElements * aNumComps);
+          for(int aCol = 0; aCol < aNumComps; aCol++) {
+            ModelAPI_AttributeTables::Value aDefault = aTables->value(0, aCol, aStepIndex);
+            for(int anElem = 0; anElem < aNumElements; anElem++)
+              aValues[anElem * aNumComps + aCol] = aDefault;
+          }
           // omit default values first row
-          for(int aRow = isWholePart ? 0 : 1; aRow < aNumElements; aRow++) {
-            for(int aCol = 0; aCol < aNumComps; aCol++) {
-              int anElementID = 0;
-              if (!isWholePart) {
-                // element index actually is the ID of the selection
-                AttributeSelectionPtr aSel = aSelectionList->value(aRow - 1);
-                if (!isSubShapesMap) {
-                  aSubShapesMap.MapShapes(aShape);
-                  isSubShapesMap = true;
-                }
-                int aReferenceID = aSubShapesMap.FindIndexEqualLocations(aSel->value());
-                if (aReferenceID == 0) // selected value does not found in the exported shape
-                  continue;
-
-                std::string aReferenceString = XAO::XaoUtils::intToString(aReferenceID);
-                anElementID = aXao.getGeometry()->
-                  getElementIndexByReference(aFieldDimension, aReferenceString);
-              }
-
-              ModelAPI_AttributeTables::Value aVal = aTables->value(
-                isWholePart ? 0 : aRow, aCol, aStepIndex);
-              std::string aStrVal = valToString(aVal, aTables->type());
-              aStep->setStringValue(isWholePart ? aRow : anElementID, aCol, aStrVal);
-              aFilledIDs.insert(anElementID);
+          for(int aRow = 1; !isWholePart && aRow < aTables->rows(); aRow++) {
+            // element index actually is the ID of the selection
+            AttributeSelectionPtr aSel = aSelectionList->value(aRow - 1);
+            if (!isSubShapesMap) {
+              aSubShapesMap.MapShapes(aShape);
+              isSubShapesMap = true;
             }
+            int aReferenceID = aSubShapesMap.FindIndexEqualLocations(aSel->value());
+            if (aReferenceID == 0) // selected value does not found in the exported shape
+              continue;
+
+            std::string aReferenceString = XAO::XaoUtils::intToString(aReferenceID);
+            int anElementID = aXao.getGeometry()->
+              getElementIndexByReference(aFieldDimension, aReferenceString);
+            for(int aCol = 0; aCol < aNumComps; aCol++)
+              aValues[anElementID * aNumComps + aCol] = aTables->value(aRow, aCol, aStepIndex);
           }
-          if (!isWholePart) { // fill the rest values by default ones
-            XAO::GeometricElementList::iterator allElem =
-              aXao.getGeometry()->begin(aFieldDimension);
-            for(; allElem != aXao.getGeometry()->end(aFieldDimension); allElem++) {
-              if (aFilledIDs.find(allElem->first) != aFilledIDs.end())
-                continue;
-              for(int aCol = 0; aCol < aNumComps; aCol++) {
-                // default value
-                ModelAPI_AttributeTables::Value aVal = aTables->value(0, aCol, aStepIndex);
-                std::string aStrVal = valToString(aVal, aTables->type());
-                aStep->setStringValue(allElem->first, aCol, aStrVal);
-              }
-            }
+          // pass all values of the step at once, without conversion to strings
+          switch(aTables->type()) {
+          case ModelAPI_AttributeTables::BOOLEAN:
+            setStepValues(static_cast<XAO::BooleanStep*>(aStep),
+              &ModelAPI_AttributeTables::Value::myBool, aValues);
+            break;
+          case ModelAPI_AttributeTables::INTEGER:
+            setStepValues(static_cast<XAO::IntegerStep*>(aStep),
+              &ModelAPI_AttributeTables::Value::myInt, aValues);
+            break;
+          case ModelAPI_AttributeTables::DOUBLE:
+            setStepValues(static_cast<XAO::DoubleStep*>(aStep),
+              &ModelAPI_AttributeTables::Value::myDouble, aValues);
+            break;
+          case ModelAPI_AttributeTables::STRING:
+            setStepValues(static_cast<XAO::StringStep*>(aStep),
+              &ModelAPI_AttributeTables::Value::myStr, aValues);
+            break;
           }
         }
       } catch (XAO::XAO_Exception& e) {
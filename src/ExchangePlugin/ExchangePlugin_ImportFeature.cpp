@@ -64,10 +64,15 @@
 #include <XAO_Group.hxx>
 #include <XAO_Field.hxx>
 #include <XAO_Step.hxx>
+#include <XAO_BooleanStep.hxx>
+#include <XAO_IntegerStep.hxx>
+#include <XAO_DoubleStep.hxx>
+#include <XAO_StringStep.hxx>
 
 #include <ExchangePlugin_Tools.h>
 
 #include <iostream>
+#include <sstream>
 #include <QPixmap>
 
 /*
@@ -180,6 +185,15 @@ std::shared_ptr<ModelAPI_ResultBody> ExchangePlugin_ImportFeatureBase::createRes
   return aResultBody;
 }
 
+/// Returns the key of the file in the import cache, or an empty string if the file is not found
+static std::string importCacheKey(const std::string& theFileName, const std::string& theOptions)
+{
+  std::string aStamp = GeomAlgoAPI_Tools::File_Tools::stamp(theFileName);
+  if (aStamp.empty())
+    return aStamp;
+  return theFileName + "\n" + aStamp + "\n" + theOptions;
+}
+
 void ExchangePlugin_ImportFeature::importFile(const std::string& theFileName)
 {
   // "*.brep" -> "BREP"
@@ -200,10 +214,10 @@ void ExchangePlugin_ImportFeature::importFile(const std::string& theFileName)
 
   ResultBodyPtr aResult = document()->createBody(data());
   bool anColorGroupSelected = false, anMaterialsGroupSelected = false;
-  if (anExtension == "BREP" || anExtension == "BRP") {
-    aGeomShape = BREPImport(theFileName, anExtension, anError);
-  } else if (anExtension == "STEP" || anExtension == "STP") {
-    bool anScalInterUnits = boolean(STEP_SCALE_INTER_UNITS_ID())->value();
+  bool anScalInterUnits = false;
+  bool isSTEP = anExtension == "STEP" || anExtension == "STP";
+  if (isSTEP) {
+    anScalInterUnits = boolean(STEP_SCALE_INTER_UNITS_ID())->value();
     anColorGroupSelected = boolean(STEP_COLORS_ID())->value();
     anMaterialsGroupSelected = boolean(STEP_MATERIALS_ID())->value();
 
@@ -218,7 +232,28 @@ void ExchangePlugin_ImportFeature::importFile(const std::string& theFileName)
       if (aFeature)
         document()->removeFeature(aFeature);
     }
+  }
 
+  // the file is not translated again if it and the import options are not changed
+  std::ostringstream anOptions;
+  anOptions << anScalInterUnits << anColorGroupSelected << anMaterialsGroupSelected;
+  // another feature importing the same file gets a copy of the shape, not the same one
+  std::ostringstream anOwner;
+  anOwner << document()->id() << ":" << data()->featureId();
+  GeomAlgoAPI_Tools::Import_Tools::TranslatedPtr anImported(
+    new GeomAlgoAPI_Tools::Import_Tools::Translated);
+  anImported->myKey = importCacheKey(theFileName, anOptions.str());
+  anImported->myOwner = anOwner.str();
+  GeomAlgoAPI_Tools::Import_Tools::TranslatedPtr aCached =
+    GeomAlgoAPI_Tools::Import_Tools::translated(anImported->myKey, anImported->myOwner);
+
+  if (aCached) {
+    aGeomShape = aCached->myShape;
+    aResult->setShapeName(aCached->myShapeNames, aCached->myShapeColors);
+    theMaterialShape = aCached->myMaterialShape;
+  } else if (anExtension == "BREP" || anExtension == "BRP") {
+    aGeomShape = BREPImport(theFileName, anExtension, anError);
+  } else if (isSTEP) {
     aGeomShape = STEPImportAttributs(theFileName, aResult, anScalInterUnits,
                                      anMaterialsGroupSelected, anColorGroupSelected,
                                      theMaterialShape, anError);
@@ -236,6 +271,13 @@ void ExchangePlugin_ImportFeature::importFile(const std::string& theFileName)
     return;
   }
 
+  if (!aCached && aGeomShape.get()) {
+    anImported->myShape = aGeomShape;
+    aResult->getShapeName(anImported->myShapeNames, anImported->myShapeColors);
+    anImported->myMaterialShape = theMaterialShape;
+    GeomAlgoAPI_Tools::Import_Tools::store(anImported);
+  }
+
   // Pass the results into the model
   loadNamingDS(aGeomShape, aResult);
 
@@ -388,6 +430,21 @@ void ExchangePlugin_ImportFeature::setMaterielGroup(
   }
 }
 
+/// Copies values of XAO step (element by element) to the tables, the first row is for defaults
+template<typename TYPE>
+static void stepToTables(const std::vector<TYPE>& theValues,
+                         TYPE ModelAPI_AttributeTables::Value::* theMember,
+                         const int theNbComponents, const int theStepIndex,
+                         std::shared_ptr<ModelAPI_AttributeTables> theTables)
+{
+  ModelAPI_AttributeTables::Value aVal;
+  for (size_t anIndex = 0; anIndex < theValues.size(); ++anIndex) {
+    aVal.*theMember = theValues[anIndex];
+    int aRow = (int)anIndex / theNbComponents + 1;
+    theTables->setValue(aVal, aRow, (int)anIndex % theNbComponents, theStepIndex);
+  }
+}
+
 void ExchangePlugin_ImportFeature::importXAO(const std::string& theFileName,
                                              const std::string& theMemoryBuff,
                                              const bool         isMemoryImport)
@@ -528,30 +585,28 @@ void ExchangePlugin_ImportFeature::importXAO(const std::string& theFileName,
     aTables->setSize(
       aXaoField->countElements() + 1, aXaoField->countComponents(), aXaoField->countSteps());
     aTables->setType(aType);
-    // iterate steps
+    // iterate steps, values are taken from the steps storage without conversion to strings
     XAO::stepIterator aStepIter = aXaoField->begin();
+    int aNbComponents = aXaoField->countComponents();
     for(int aStepIndex = 0; aStepIter != aXaoField->end(); aStepIter++, aStepIndex++) {
       aStamps->setValue(aStepIndex, (*aStepIter)->getStamp());
-      for(int aRow = 1; aRow <= aXaoField->countElements(); aRow++) {
-        for(int aCol = 0; aCol < aXaoField->countComponents(); aCol++) {
-          ModelAPI_AttributeTables::Value aVal;
-          std::string aValStr = (*aStepIter)->getStringValue(aRow - 1, aCol);
-          switch(aType) {
-          case ModelAPI_AttributeTables::BOOLEAN:
-            aVal.myBool = aValStr == "true";
-            break;
-          case ModelAPI_AttributeTables::INTEGER:
-            aVal.myInt = atoi(aValStr.c_str());
-            break;
-          case ModelAPI_AttributeTables::DOUBLE:
-            aVal.myDouble = atof(aValStr.c_str());
-            break;
-          case ModelAPI_AttributeTables::STRING:
-            aVal.myStr = aValStr;
-            break;
-          }
-          aTables->setValue(aVal, aRow, aCol, aStepIndex);
-        }
+      switch(aType) {
+      case ModelAPI_AttributeTables::BOOLEAN:
+        stepToTables(static_cast<XAO::BooleanStep*>(*aStepIter)->getRawValues(),
+          &ModelAPI_AttributeTables::Value::myBool, aNbComponents, aStepIndex, aTables);
+        break;
+      case ModelAPI_AttributeTables::INTEGER:
+        stepToTables(static_cast<XAO::IntegerStep*>(*aStepIter)->getRawValues(),
+          &ModelAPI_AttributeTables::Value::myInt, aNbComponents, aStepIndex, aTables);
+        break;
+      case ModelAPI_AttributeTables::DOUBLE:
+        stepToTables(static_cast<XAO::DoubleStep*>(*aStepIter)->getRawValues(),
+          &ModelAPI_AttributeTables::Value::myDouble, aNbComponents, aStepIndex, aTables);
+        break;
+      case ModelAPI_AttributeTables::STRING:
+        stepToTables(static_cast<XAO::StringStep*>(*aStepIter)->getRawValues(),
+          &ModelAPI_AttributeTables::Value::myStr, aNbComponents, aStepIndex, aTables);
+        break;
       }
     }
     // remove everything with zero-values: zeroes are treated as defaults
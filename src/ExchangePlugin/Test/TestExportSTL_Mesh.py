@@ -0,0 +1,74 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+"""
+      TestExportSTL_Mesh.py
+      Checks the mesh of the STL export follows the requested deflection and the location
+      of the exported shape, whatever was meshed before.
+"""
+import os
+import math
+from tempfile import TemporaryDirectory
+
+from salome.shaper import model
+
+# returns the number of facets and the maximal X of the vertices of an ASCII STL file
+def readSTL(theFile):
+  aNbFacets = 0
+  aMaxX = -1.e100
+  with open(theFile, "r") as aFile:
+    for aLine in aFile:
+      aWords = aLine.split()
+      if len(aWords) > 0 and aWords[0] == "facet":
+        aNbFacets += 1
+      elif len(aWords) == 4 and aWords[0] == "vertex":
+        aMaxX = max(aMaxX, float(aWords[1]))
+  return aNbFacets, aMaxX
+
+def exportSTL(theDoc, theFile, theSelection, theDeflection):
+  model.exportToSTL(theDoc, theFile, theSelection, 0.0001, theDeflection, False, True)
+  return readSTL(theFile)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Cylinder_1 = model.addCylinder(Part_1_doc, 5, 10)
+model.end()
+
+with TemporaryDirectory() as tmp_dir:
+  aFile = os.path.join(tmp_dir, "mesh.stl")
+
+  aCoarse, aMaxX = exportSTL(Part_1_doc, aFile, model.selection("SOLID", "Cylinder_1_1"), 0.1)
+  assert(math.fabs(aMaxX - 5) < 1.e-3), "Wrong max X: {}".format(aMaxX)
+  aFine, aMaxX = exportSTL(Part_1_doc, aFile, model.selection("SOLID", "Cylinder_1_1"), 0.001)
+  assert(aFine > aCoarse), "The finer mesh has {} facets, the coarse one {}".format(aFine, aCoarse)
+  # the finer mesh made before is not taken for the coarse deflection
+  aNbFacets, aMaxX = exportSTL(Part_1_doc, aFile, model.selection("SOLID", "Cylinder_1_1"), 0.1)
+  assert(aNbFacets == aCoarse), "Expected {} facets, got {}".format(aCoarse, aNbFacets)
+
+  # the copies share the meshed cylinder, but keep their own location
+  model.begin()
+  LinearCopy_1 = model.addMultiTranslation(Part_1_doc, [model.selection("SOLID", "Cylinder_1_1")],
+                                           model.selection("EDGE", "PartSet/OX"), 100, 2)
+  model.end()
+  aNbFacets, aMaxX = exportSTL(Part_1_doc, aFile, model.selection("COMPOUND", "LinearCopy_1_1"), 0.1)
+  assert(aNbFacets == 2 * aCoarse), "Expected {} facets, got {}".format(2 * aCoarse, aNbFacets)
+  assert(math.fabs(aMaxX - 105) < 1.e-3), "Wrong max X: {}".format(aMaxX)
+
@@ -0,0 +1,82 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+"""
+      TestImport_Rewritten.py
+      Checks the file rewritten after the import is translated again on the next import.
+"""
+import os
+import math
+from tempfile import TemporaryDirectory
+
+from salome.shaper import model
+from GeomAlgoAPI import GeomAlgoAPI_ShapeTools
+
+def checkVolume(theImport, theVolume):
+  assert(theImport.feature().error() == ''), theImport.feature().error()
+  aVolume = GeomAlgoAPI_ShapeTools.volume(theImport.feature().firstResult().shape())
+  assert(math.fabs(aVolume - theVolume) < 1.e-7), \
+    "The volume is wrong: expected = {0}, real = {1}".format(theVolume, aVolume)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Box_2 = model.addBox(Part_1_doc, 20, 20, 20)
+Part_2 = model.addPart(partSet)
+Part_2_doc = Part_2.document()
+model.end()
+
+with TemporaryDirectory() as tmp_dir:
+  aFile = os.path.join(tmp_dir, "rewritten.brep")
+
+  model.exportToFile(Part_1_doc, aFile, [Box_1.result()])
+  aStat = os.stat(aFile)
+  model.begin()
+  Import_1 = model.addImport(Part_2_doc, aFile)
+  model.end()
+  checkVolume(Import_1, 1000)
+
+  # rewrite the file and keep its access time: only the modification time tells it is changed
+  model.exportToFile(Part_1_doc, aFile, [Box_2.result()])
+  os.utime(aFile, (aStat.st_atime, aStat.st_mtime + 10))
+  model.begin()
+  Import_2 = model.addImport(Part_2_doc, aFile)
+  model.end()
+  checkVolume(Import_2, 8000)
+
+  # the file is not changed anymore: the cached translation is used, but the shape is copied
+  # for another feature, so, the features do not share the same shape
+  model.begin()
+  Import_3 = model.addImport(Part_2_doc, aFile)
+  model.end()
+  checkVolume(Import_3, 8000)
+  aShape2 = Import_2.feature().firstResult().shape()
+  aShape3 = Import_3.feature().firstResult().shape()
+  assert(not aShape2.isSame(aShape3)), "Different imports share the same shape"
+
+  # closing all documents releases the cached translations: the file is imported again
+  model.reset()
+  model.begin()
+  partSet = model.moduleDocument()
+  Part_3 = model.addPart(partSet)
+  Import_4 = model.addImport(Part_3.document(), aFile)
+  model.end()
+  checkVolume(Import_4, 8000)
@@ -0,0 +1,77 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+
+"""
+      TestStep_Large.py
+      Import of a large generated STEP file without and with the names, colors and materials
+"""
+
+from GeomAPI import *
+from salome.shaper import model
+
+import os
+import time
+from tempfile import TemporaryDirectory
+
+NB_X = 20
+NB_Y = 20
+NB_SOLIDS = NB_X * NB_Y
+MAX_ATTRIBUTES_RATIO = 10
+
+def importStep(theDoc, theFile, theAttributes):
+  tStart = time.time()
+  model.begin()
+  anImport = model.addImportSTEP(theDoc, theFile, False, theAttributes, theAttributes)
+  model.do()
+  model.end()
+  return anImport, time.time() - tStart
+
+with TemporaryDirectory() as tmp_dir:
+  aStepFile = os.path.join(tmp_dir, "large.step")
+
+  model.begin()
+  partSet = model.moduleDocument()
+  Part_1 = model.addPart(partSet)
+  Part_1_doc = Part_1.document()
+  Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+  LinearCopy_1 = model.addMultiTranslation(Part_1_doc, [model.selection("SOLID", "Box_1_1")], model.selection("EDGE", "PartSet/OX"), 20, NB_X, model.selection("EDGE", "PartSet/OY"), 20, NB_Y)
+  model.exportToFile(Part_1_doc, aStepFile, [model.selection("COMPOUND", "LinearCopy_1_1")])
+  model.end()
+
+  assert(os.path.exists(aStepFile))
+
+  model.begin()
+  Part_2 = model.addPart(partSet)
+  Part_2_doc = Part_2.document()
+  model.end()
+
+  Import_1, tShapes = importStep(Part_2_doc, aStepFile, False)
+  Import_2, tAttributes = importStep(Part_2_doc, aStepFile, True)
+
+  for anImport in [Import_1, Import_2]:
+    model.testNbResults(anImport, 1)
+    model.testNbSubShapes(anImport, GeomAPI_Shape.SOLID, [NB_SOLIDS])
+    model.testNbSubShapes(anImport, GeomAPI_Shape.FACE, [6 * NB_SOLIDS])
+    model.testResultsVolumes(anImport, [1000 * NB_SOLIDS])
+
+  # the names, colors and materials are read for each sub-shape once, so, their import
+  # must not be much longer than the import of the shapes only
+  assert(tAttributes < MAX_ATTRIBUTES_RATIO * tShapes), \
+    "Import with names, colors and materials is too long: {:.3f} s, shapes only: {:.3f} s".format(tAttributes, tShapes)
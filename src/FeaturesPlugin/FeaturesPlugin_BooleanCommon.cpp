@@ -66,6 +66,29 @@ void FeaturesPlugin_BooleanCommon::initAttributes()
   initVersion(BOP_VERSION_9_4(), selectionList(OBJECT_LIST_ID()), selectionList(TOOL_LIST_ID()));
 }
 
+//==================================================================================================
+bool FeaturesPlugin_BooleanCommon::prepareArguments()
+{
+  // in the simple mode the objects are intersected one by one by execute
+  AttributeStringPtr aCreationMethodAttr = string(CREATION_METHOD());
+  if (aCreationMethodAttr.get() && aCreationMethodAttr->value() == CREATION_METHOD_SIMPLE())
+    return false;
+
+  GeomAPI_ShapeHierarchy anObjects, aTools;
+  ListOfShape aPlanes;
+  // the operations with planes are not prepared: planes are resized to the objects by execute
+  if (!processAttribute(OBJECT_LIST_ID(), anObjects, aPlanes))
+    return false;
+  aPlanes.clear();
+  if (!processAttribute(TOOL_LIST_ID(), aTools, aPlanes) ||
+      anObjects.empty() || aTools.empty() || !aPlanes.empty())
+    return false;
+
+  bool aUseFuzzy = boolean(USE_FUZZY_ID())->value();
+  double aFuzzy = (aUseFuzzy ? real(FUZZY_PARAM_ID())->value() : -1);
+  return prepareObjects(GeomAlgoAPI_Tools::BOOL_COMMON, anObjects, aTools.objects(), aFuzzy);
+}
+
 //==================================================================================================
 void FeaturesPlugin_BooleanCommon::execute()
 {
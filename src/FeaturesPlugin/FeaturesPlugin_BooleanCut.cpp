@@ -68,6 +68,23 @@ void FeaturesPlugin_BooleanCut::initAttributes()
   initVersion(BOP_VERSION_9_4(), selectionList(OBJECT_LIST_ID()), selectionList(TOOL_LIST_ID()));
 }
 
+//==================================================================================================
+bool FeaturesPlugin_BooleanCut::prepareArguments()
+{
+  GeomAPI_ShapeHierarchy anObjects, aTools;
+  ListOfShape aPlanes;
+  // the operations with planes are not prepared: planes are resized to the objects by execute
+  if (!processAttribute(OBJECT_LIST_ID(), anObjects, aPlanes) ||
+      !processAttribute(TOOL_LIST_ID(), aTools, aPlanes) ||
+      anObjects.empty() || aTools.empty() || !aPlanes.empty())
+    return false;
+
+  bool aUseFuzzy = boolean(USE_FUZZY_ID())->value();
+  double aFuzzy = (aUseFuzzy ? real(FUZZY_PARAM_ID())->value() : -1);
+  return prepareObjects(GeomAlgoAPI_Tools::BOOL_CUT, anObjects,
+                        ExplodeCompounds(aTools.objects()), aFuzzy);
+}
+
 //==================================================================================================
 void FeaturesPlugin_BooleanCut::execute()
 {
@@ -52,6 +52,9 @@ public:
   /// Performs the algorithm and stores results it in the data structure.
   FEATURESPLUGIN_EXPORT virtual void execute();
 
+  /// Collects the objects and the tools for the concurrent preparation of the operation
+  FEATURESPLUGIN_EXPORT virtual bool prepareArguments();
+
 public:
 
   /// Use plugin manager for features creation.
@@ -18,9 +18,11 @@
 //
 
 #include "FeaturesPlugin_Extrusion.h"
+#include "FeaturesPlugin_Tools.h"
 
 #include <ModelAPI_AttributeDouble.h>
 #include <ModelAPI_AttributeSelection.h>
+#include <ModelAPI_AttributeSelectionList.h>
 #include <ModelAPI_AttributeString.h>
 #include <ModelAPI_Session.h>
 #include <ModelAPI_Validator.h>
@@ -90,6 +92,97 @@ void FeaturesPlugin_Extrusion::execute()
   removeResults(aResultIndex);
 }
 
+//=================================================================================================
+bool FeaturesPlugin_Extrusion::prepareArguments()
+{
+  myPreparedPrisms.clear();
+  myPreparedBaseShapes.clear();
+  // the same base shapes as getBaseShapes gives, but the errors are reported by execute only
+  std::string anError;
+  if (!FeaturesPlugin_Tools::getShape(selectionList(BASE_OBJECTS_ID()), true,
+                                      myPreparedBaseShapes, anError))
+    return false;
+
+  myPreparedSelection.clear();
+  selectedShapes(myPreparedSelection);
+  myPreparedMethod = string(CREATION_METHOD())->value();
+  myPreparedArgs = PrismArguments();
+  getPrismArguments(myPreparedArgs);
+  return !myPreparedBaseShapes.empty();
+}
+
+//=================================================================================================
+void FeaturesPlugin_Extrusion::prepareExecution()
+{
+  // called in a worker thread: uses only the collected arguments, errors are reported by execute
+  myPreparedPrisms.clear();
+  for(ListOfShape::const_iterator anIter = myPreparedBaseShapes.cbegin();
+      anIter != myPreparedBaseShapes.cend(); anIter++) {
+    myPreparedPrisms.push_back(GeomMakeShapePtr(new GeomAlgoAPI_Prism(*anIter,
+      myPreparedArgs.myDir, myPreparedArgs.myToShape, myPreparedArgs.myToSize,
+      myPreparedArgs.myFromShape, myPreparedArgs.myFromSize)));
+  }
+}
+
+// Returns the shape selected in the attribute or the shape of its context, null if none
+static GeomShapePtr selectedShape(const AttributeSelectionPtr& theSelection)
+{
+  GeomShapePtr aShape;
+  if (theSelection.get()) {
+    aShape = theSelection->value();
+    if (!aShape.get() && theSelection->context().get())
+      aShape = theSelection->context()->shape();
+  }
+  return aShape;
+}
+
+//=================================================================================================
+void FeaturesPlugin_Extrusion::selectedShapes(ListOfShape& theShapes)
+{
+  AttributeSelectionListPtr aBaseObjects = selectionList(BASE_OBJECTS_ID());
+  for (int anIndex = 0; aBaseObjects.get() && anIndex < aBaseObjects->size(); anIndex++)
+    theShapes.push_back(selectedShape(aBaseObjects->value(anIndex)));
+  theShapes.push_back(selectedShape(selection(DIRECTION_OBJECT_ID())));
+  theShapes.push_back(selectedShape(selection(TO_OBJECT_ID())));
+  theShapes.push_back(selectedShape(selection(FROM_OBJECT_ID())));
+}
+
+//=================================================================================================
+bool FeaturesPlugin_Extrusion::preparedPrisms(ListOfShape& theBaseShapes,
+                                              ListOfShape& theBoundaryShapes,
+                                              ListOfMakeShape& thePrisms)
+{
+  bool isPrepared = !myPreparedPrisms.empty() &&
+                    myPreparedMethod == string(CREATION_METHOD())->value();
+  if (isPrepared) {
+    double aToSize = 0.0;
+    double aFromSize = 0.0;
+    getSizes(aToSize, aFromSize);
+    isPrepared = aToSize == myPreparedArgs.myToSize && aFromSize == myPreparedArgs.myFromSize;
+  }
+  if (isPrepared) {
+    ListOfShape aSelection;
+    selectedShapes(aSelection);
+    isPrepared = aSelection.size() == myPreparedSelection.size();
+    ListOfShape::const_iterator aPrepIt = myPreparedSelection.cbegin();
+    ListOfShape::const_iterator aCurIt = aSelection.cbegin();
+    for(; isPrepared && aCurIt != aSelection.cend(); ++aCurIt, ++aPrepIt) {
+      isPrepared = aCurIt->get() ? aPrepIt->get() && (*aCurIt)->isEqual(*aPrepIt)
+                                 : !aPrepIt->get();
+    }
+  }
+  if (isPrepared) {
+    theBaseShapes = myPreparedBaseShapes;
+    theBoundaryShapes = myPreparedArgs.myBoundaryShapes;
+    thePrisms = myPreparedPrisms;
+  }
+  myPreparedPrisms.clear();
+  myPreparedBaseShapes.clear();
+  myPreparedSelection.clear();
+  myPreparedArgs = PrismArguments();
+  return isPrepared;
+}
+
 //=================================================================================================
 bool FeaturesPlugin_Extrusion::makeExtrusions(ListOfShape& theBaseShapes,
                                               ListOfShape& theBoundaryShapes,
@@ -97,17 +190,55 @@ bool FeaturesPlugin_Extrusion::makeExtrusions(ListOfShape& theBaseShapes,
 {
   theMakeShapes.clear();
 
-  // Getting base shapes.
-  getBaseShapes(theBaseShapes);
+  // Getting the prisms built in advance, if they are built from the same arguments.
+  ListOfMakeShape aPreparedPrisms;
+  bool isPrepared = preparedPrisms(theBaseShapes, theBoundaryShapes, aPreparedPrisms);
+
+  PrismArguments anArgs;
+  if (!isPrepared) {
+    // Getting base shapes.
+    getBaseShapes(theBaseShapes);
+
+    // Getting direction, sizes and bounding planes.
+    getPrismArguments(anArgs);
+    theBoundaryShapes.insert(theBoundaryShapes.end(),
+                             anArgs.myBoundaryShapes.begin(), anArgs.myBoundaryShapes.end());
+  }
+
+  // Generating result for each base shape.
+  std::string anError;
+  ListOfMakeShape::const_iterator aPreparedIt = aPreparedPrisms.cbegin();
+  for(ListOfShape::const_iterator
+      anIter = theBaseShapes.cbegin(); anIter != theBaseShapes.cend(); anIter++) {
+    std::shared_ptr<GeomAPI_Shape> aBaseShape = *anIter;
+
+    GeomMakeShapePtr aPrismAlgo;
+    if (isPrepared)
+      aPrismAlgo = *(aPreparedIt++);
+    else {
+      aPrismAlgo.reset(new GeomAlgoAPI_Prism(aBaseShape, anArgs.myDir,
+                                             anArgs.myToShape, anArgs.myToSize,
+                                             anArgs.myFromShape, anArgs.myFromSize));
+    }
+    if (GeomAlgoAPI_Tools::AlgoError::isAlgorithmFailed(aPrismAlgo, getKind(), anError)) {
+      setError(anError);
+      return false;
+    }
 
+    theMakeShapes.push_back(aPrismAlgo);
+  }
+
+  return true;
+}
+
+//=================================================================================================
+void FeaturesPlugin_Extrusion::getPrismArguments(PrismArguments& theArgs)
+{
   //Getting direction.
-  std::shared_ptr<GeomAPI_Dir> aDir;
-  getDirection(aDir);
+  getDirection(theArgs.myDir);
 
   // Getting sizes.
-  double aToSize = 0.0;
-  double aFromSize = 0.0;
-  getSizes(aToSize, aFromSize);
+  getSizes(theArgs.myToSize, theArgs.myFromSize);
 
   // Getting bounding planes.
   GeomShapePtr aToShape;
@@ -138,28 +269,11 @@ bool FeaturesPlugin_Extrusion::makeExtrusions(ListOfShape& theBaseShapes,
     }
   }
   if (aToShape && !aToShape->isPlanar())
-    theBoundaryShapes.push_back(aToShape);
+    theArgs.myBoundaryShapes.push_back(aToShape);
   if (aFromShape && !aFromShape->isPlanar())
-    theBoundaryShapes.push_back(aFromShape);
-
-  // Generating result for each base shape.
-  std::string anError;
-  for(ListOfShape::const_iterator
-      anIter = theBaseShapes.cbegin(); anIter != theBaseShapes.cend(); anIter++) {
-    std::shared_ptr<GeomAPI_Shape> aBaseShape = *anIter;
-
-    std::shared_ptr<GeomAlgoAPI_Prism> aPrismAlgo(new GeomAlgoAPI_Prism(aBaseShape, aDir,
-                                                                        aToShape, aToSize,
-                                                                        aFromShape, aFromSize));
-    if (GeomAlgoAPI_Tools::AlgoError::isAlgorithmFailed(aPrismAlgo, getKind(), anError)) {
-      setError(anError);
-      return false;
-    }
-
-    theMakeShapes.push_back(aPrismAlgo);
-  }
-
-  return true;
+    theArgs.myBoundaryShapes.push_back(aFromShape);
+  theArgs.myToShape = aToShape;
+  theArgs.myFromShape = aFromShape;
 }
 
 //=================================================================================================
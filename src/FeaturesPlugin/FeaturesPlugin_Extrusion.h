@@ -26,6 +26,8 @@
 
 #include <GeomAlgoAPI_MakeShape.h>
 
+class GeomAPI_Dir;
+
 /// \class FeaturesPlugin_Extrusion
 /// \ingroup Plugins
 /// \brief Feature for creation of extrusion from the planar face.
@@ -136,7 +138,25 @@ public:
   /// Performs the algorithm and stores results it in the data structure.
   FEATURESPLUGIN_EXPORT virtual void execute();
 
+  /// Collects the base shapes and the parameters of the prisms for the concurrent preparation
+  FEATURESPLUGIN_EXPORT virtual bool prepareArguments();
+
+  /// Builds the prisms for the next execute from the collected arguments
+  FEATURESPLUGIN_EXPORT virtual void prepareExecution();
+
 protected:
+  /// Parameters of the prisms built for each base shape
+  struct PrismArguments {
+    ListOfShape myBoundaryShapes; ///< not planar faces limiting the extrusion
+    std::shared_ptr<GeomAPI_Dir> myDir;
+    GeomShapePtr myToShape;
+    double myToSize;
+    GeomShapePtr myFromShape;
+    double myFromSize;
+
+    PrismArguments() : myToSize(0.0), myFromSize(0.0) {}
+  };
+
   /// Generates extrusions.
   /// \param[out] theBaseShapes list of base shapes.
   /// \param[out] theBoundaryShapes list of faces limiting the extrusion
@@ -157,6 +177,26 @@ protected:
 
   /// Retrieve or calculate prism sizes.
   virtual void getSizes(double& theToSize, double& theFromSize);
+
+  /// Retrieve the direction, the sizes and the bounding shapes of prisms.
+  void getPrismArguments(PrismArguments& theArgs);
+
+private:
+  /// Returns the shapes selected in the attributes of the extrusion.
+  void selectedShapes(ListOfShape& theShapes);
+
+  /// Returns the prisms built by prepareExecution and their base and boundary shapes if the
+  /// selected shapes, the method and the sizes are the same as on prepareArguments.
+  /// In any case the prepared prisms are released.
+  bool preparedPrisms(ListOfShape& theBaseShapes,
+                      ListOfShape& theBoundaryShapes,
+                      ListOfMakeShape& thePrisms);
+
+  ListOfShape myPreparedSelection; ///< shapes selected when the arguments were collected
+  std::string myPreparedMethod; ///< creation method when the arguments were collected
+  ListOfShape myPreparedBaseShapes; ///< base shapes of the prepared prisms
+  PrismArguments myPreparedArgs; ///< parameters of the prepared prisms
+  ListOfMakeShape myPreparedPrisms; ///< prisms built by prepareExecution
 };
 
 #endif
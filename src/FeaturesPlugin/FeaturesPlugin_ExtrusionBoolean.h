@@ -33,6 +33,10 @@ public:
   /// Request for initialization of data model of the feature: adding all attributes.
   FEATURESPLUGIN_EXPORT virtual void initAttributes();
 
+  /// The sizes of extrusion may depend on the objects of the boolean operation and the
+  /// boolean operation is made by execute, so, the feature is not prepared concurrently
+  FEATURESPLUGIN_EXPORT virtual bool prepareArguments() { return false; }
+
 protected:
   FeaturesPlugin_ExtrusionBoolean(){};
 
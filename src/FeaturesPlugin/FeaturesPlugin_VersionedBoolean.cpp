@@ -103,7 +103,8 @@ bool FeaturesPlugin_VersionedBoolean::processAttribute(const std::string& theAtt
     if (!anObject.get()) {
       // It could be a construction plane.
       ResultPtr aContext = anObjectAttr->context();
-      anObject = anObjectAttr->context()->shape();
+      if (aContext.get())
+        anObject = aContext->shape();
       if (anObject.get()) {
         thePlanesList.push_back(anObject);
         continue;
@@ -119,6 +120,68 @@ bool FeaturesPlugin_VersionedBoolean::processAttribute(const std::string& theAtt
   return true;
 }
 
+//=================================================================================================
+bool FeaturesPlugin_VersionedBoolean::prepareObjects(
+    const GeomAlgoAPI_Tools::BOPType theBooleanType,
+    GeomAPI_ShapeHierarchy& theObjects,
+    const ListOfShape& theTools,
+    const double theFuzzy)
+{
+  myPreparedBooleans.clear();
+  const ListOfShape& anObjects = theObjects.objects();
+  for (ListOfShape::const_iterator anIt = anObjects.cbegin(); anIt != anObjects.cend(); ++anIt) {
+    if (theObjects.parent(*anIt, false).get())
+      continue; // sub-shapes of compounds and compsolids are processed together with the parent
+    PreparedBoolean aBoolean;
+    aBoolean.myType = theBooleanType;
+    aBoolean.myObject = *anIt;
+    aBoolean.myTools = theTools;
+    aBoolean.myFuzzy = theFuzzy;
+    myPreparedBooleans.push_back(aBoolean);
+  }
+  return !myPreparedBooleans.empty();
+}
+
+//=================================================================================================
+void FeaturesPlugin_VersionedBoolean::prepareExecution()
+{
+  // called in a worker thread: uses only the collected shapes, errors are reported by execute
+  std::list<PreparedBoolean>::iterator anIt = myPreparedBooleans.begin();
+  for (; anIt != myPreparedBooleans.end(); ++anIt) {
+    ListOfShape aListWithObject;
+    aListWithObject.push_back(anIt->myObject);
+    anIt->myAlgo.reset(new GeomAlgoAPI_Boolean(aListWithObject, anIt->myTools,
+                                               anIt->myType, anIt->myFuzzy));
+  }
+}
+
+//=================================================================================================
+GeomMakeShapePtr FeaturesPlugin_VersionedBoolean::preparedBoolean(
+    const GeomAlgoAPI_Tools::BOPType theBooleanType,
+    const GeomShapePtr& theObject,
+    const ListOfShape& theTools,
+    const double theFuzzy)
+{
+  GeomMakeShapePtr anAlgo;
+  std::list<PreparedBoolean>::iterator anIt = myPreparedBooleans.begin();
+  for (; anIt != myPreparedBooleans.end(); ++anIt) {
+    if (anIt->myType != theBooleanType || anIt->myFuzzy != theFuzzy ||
+        !anIt->myObject->isEqual(theObject) || anIt->myTools.size() != theTools.size())
+      continue;
+    bool isSameTools = true;
+    ListOfShape::const_iterator aPrepIt = anIt->myTools.cbegin();
+    ListOfShape::const_iterator aToolIt = theTools.cbegin();
+    for (; isSameTools && aToolIt != theTools.cend(); ++aToolIt, ++aPrepIt)
+      isSameTools = (*aPrepIt)->isEqual(*aToolIt);
+    if (isSameTools) {
+      anAlgo = anIt->myAlgo;
+      myPreparedBooleans.erase(anIt);
+      break;
+    }
+  }
+  return anAlgo;
+}
+
 //=================================================================================================
 bool FeaturesPlugin_VersionedBoolean::processObject(
     const GeomAlgoAPI_Tools::BOPType theBooleanType,
@@ -145,11 +208,16 @@ bool FeaturesPlugin_VersionedBoolean::processObject(
 
   if (theBooleanType == GeomAlgoAPI_Tools::BOOL_PARTITION)
     aBoolAlgo.reset(new GeomAlgoAPI_Partition(aListWithObject, aToolsWithPlanes, theFuzzy));
-  else
-    aBoolAlgo.reset(new GeomAlgoAPI_Boolean(aListWithObject,
-                                            aToolsWithPlanes,
-                                            theBooleanType,
-                                            theFuzzy));
+  else {
+    // the operation may be built in advance by prepareExecution
+    if (thePlanes.empty())
+      aBoolAlgo = preparedBoolean(theBooleanType, theObject, theTools, theFuzzy);
+    if (!aBoolAlgo.get())
+      aBoolAlgo.reset(new GeomAlgoAPI_Boolean(aListWithObject,
+                                              aToolsWithPlanes,
+                                              theBooleanType,
+                                              theFuzzy));
+  }
 
   // Checking that the algorithm worked properly.
   std::string anError;
@@ -24,6 +24,7 @@
 #include "FeaturesPlugin_Tools.h"
 
 #include <GeomAPI_ShapeHierarchy.h>
+#include <GeomAlgoAPI_MakeShape.h>
 #include <GeomAlgoAPI_Tools.h>
 
 #include <ModelAPI_Feature.h>
@@ -38,7 +39,20 @@ class GeomAlgoAPI_MakeShapeList;
 /// \brief Feature controls a version of Boolean operations.
 class FeaturesPlugin_VersionedBoolean : public ModelAPI_Feature
 {
+public:
+  /// Builds the Boolean operations collected by prepareObjects for the next execute
+  FEATURESPLUGIN_EXPORT virtual void prepareExecution();
+
 protected:
+  /// Boolean operation of a single object with the tools, built before the execution
+  struct PreparedBoolean {
+    GeomAlgoAPI_Tools::BOPType myType;
+    GeomShapePtr myObject;
+    ListOfShape myTools;
+    double myFuzzy;
+    GeomMakeShapePtr myAlgo; ///< built by prepareExecution
+  };
+
   static const std::string& BOP_VERSION_9_4()
   {
     static const std::string VERSION("v9.4");
@@ -62,6 +76,15 @@ protected:
                         GeomAPI_ShapeHierarchy& theObjects,
                         ListOfShape& thePlanesList);
 
+  /// Collects the objects processed by processObject (without parent compound or compsolid)
+  /// for the concurrent preparation of their Boolean operations with theTools.
+  /// The operations not used by the next execute are released by the next collection.
+  /// \return \c false if there is nothing to prepare
+  bool prepareObjects(const GeomAlgoAPI_Tools::BOPType theBooleanType,
+                      GeomAPI_ShapeHierarchy& theObjects,
+                      const ListOfShape& theTools,
+                      const double theFuzzy);
+
   /// Perform Boolean operation of the object with the tools.
   /// In case of theResultCompound is not empty, the result of Boolean operation
   /// is added to this compound, and corresponding ResultBody is not generated.
@@ -118,6 +141,16 @@ protected:
       const GeomAPI_ShapeHierarchy& theObjectsHierarchy,
       const GeomAPI_ShapeHierarchy& theToolsHierarchy,
       std::shared_ptr<GeomAlgoAPI_MakeShapeList> theMakeShapeList);
+
+private:
+  /// Returns the Boolean operation built by prepareExecution for the same arguments
+  /// and releases it, or null if there is no such operation.
+  GeomMakeShapePtr preparedBoolean(const GeomAlgoAPI_Tools::BOPType theBooleanType,
+                                   const GeomShapePtr& theObject,
+                                   const ListOfShape& theTools,
+                                   const double theFuzzy);
+
+  std::list<PreparedBoolean> myPreparedBooleans; ///< operations for the next execute
 };
 
 #endif
@@ -0,0 +1,87 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+"""
+      TestBooleans_Parallel.py
+      Intersection, Partition and Cut of generated grids of solids in the serial and parallel modes:
+      the results must be the same
+"""
+
+from GeomAPI import *
+from GeomAlgoAPI import *
+from ModelAPI import *
+from salome.shaper import model
+
+import math
+
+NB = 8
+STEP = 10
+
+def addGrids(theDoc):
+  model.addSphere(theDoc, model.selection("VERTEX", "PartSet/Origin"), 6)
+  model.addMultiTranslation(theDoc, [model.selection("SOLID", "Sphere_1_1")], model.selection("EDGE", "PartSet/OX"), STEP, NB, model.selection("EDGE", "PartSet/OY"), STEP, NB)
+  model.addBox(theDoc, STEP / 2, STEP / 2, 0, 2, 2, 2)
+  model.addMultiTranslation(theDoc, [model.selection("SOLID", "Box_1_1")], model.selection("EDGE", "PartSet/OX"), STEP, NB, model.selection("EDGE", "PartSet/OY"), STEP, NB)
+  return [model.selection("COMPOUND", "LinearCopy_1_1"), model.selection("COMPOUND", "LinearCopy_2_1")]
+
+def perform(theOperation, theParallel):
+  aSession = ModelAPI_Session.get()
+  aSession.setParallelBooleans(theParallel)
+  assert(aSession.isParallelBooleans() == theParallel)
+
+  model.begin()
+  aDoc = model.addPart(model.moduleDocument()).document()
+  anObjects = addGrids(aDoc)
+  model.end()
+
+  model.begin()
+  aFeature = theOperation(aDoc, anObjects)
+  model.do()
+  model.end()
+
+  assert(aFeature.feature().error() == "")
+  return aFeature.feature().firstResult().shape()
+
+def nbSubShapes(theShape, theType):
+  aNb = 0
+  anExp = GeomAPI_ShapeExplorer(theShape, theType)
+  while anExp.more():
+    aNb += 1
+    anExp.next()
+  return aNb
+
+OPERATIONS = [
+  ("Intersection", lambda theDoc, theObjects: model.addIntersection(theDoc, theObjects)),
+  ("Partition", lambda theDoc, theObjects: model.addPartition(theDoc, theObjects)),
+  ("Cut", lambda theDoc, theObjects: model.addCut(theDoc, [theObjects[0]], [theObjects[1]])),
+]
+
+for aName, anOperation in OPERATIONS:
+  aSerialShape = perform(anOperation, False)
+  aParallelShape = perform(anOperation, True)
+
+  for aType in [GeomAPI_Shape.SOLID, GeomAPI_Shape.FACE, GeomAPI_Shape.EDGE]:
+    assert(nbSubShapes(aSerialShape, aType) == nbSubShapes(aParallelShape, aType))
+  aSerialVolume = GeomAlgoAPI_ShapeTools.volume(aSerialShape)
+  aParallelVolume = GeomAlgoAPI_ShapeTools.volume(aParallelShape)
+  assert(math.fabs(aSerialVolume - aParallelVolume) < 1.e-7 * max(1., aSerialVolume)), \
+    "{}: volumes of serial and parallel results are different".format(aName)
+
+# parallel mode is the default one
+ModelAPI_Session.get().setParallelBooleans(True)
@@ -0,0 +1,63 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+"""
+      TestBooleans_SharedIntersection.py
+      Consecutive boolean operations on the same objects reuse the intersection of the objects:
+      the results of every operation must be the same as if it is computed alone
+"""
+
+from salome.shaper import model
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Box_2 = model.addBox(Part_1_doc, 10, 10, 10, 5, 5, 5)
+model.end()
+
+def objects():
+  return [model.selection("SOLID", "Box_1_1")]
+
+def tools():
+  return [model.selection("SOLID", "Box_2_1")]
+
+OPERATIONS = [
+  (lambda: model.addCut(Part_1_doc, objects(), tools()), 1, [875]),
+  (lambda: model.addFuse(Part_1_doc, objects(), tools()), 1, [1875]),
+  (lambda: model.addCommon(Part_1_doc, objects(), tools()), 1, [125]),
+  (lambda: model.addSmash(Part_1_doc, objects(), tools()), 1, [1875]),
+  (lambda: model.addSplit(Part_1_doc, objects(), tools()), 1, [1000]),
+  (lambda: model.addPartition(Part_1_doc, objects() + tools()), 1, [1875]),
+]
+
+# each operation is applied twice to the same boxes, so, the second one uses the shared intersection
+for anIteration in range(2):
+  for anOperation, aNbResults, aVolumes in OPERATIONS:
+    model.begin()
+    aFeature = anOperation()
+    model.end()
+    model.testNbResults(aFeature, aNbResults)
+    model.testResultsVolumes(aFeature, aVolumes)
+    model.undo()
+
+# boxes are not consumed by the undone operations
+model.testNbResults(Box_1, 1)
+model.testNbResults(Box_2, 1)
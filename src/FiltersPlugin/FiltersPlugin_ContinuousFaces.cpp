@@ -32,11 +32,18 @@
 #include <GeomAlgoAPI_ShapeTools.h>
 
 #include <map>
-#include <math.h>
 #include <iostream>
+#include <sstream>
 
 typedef std::map<GeomShapePtr, SetOfShapes, GeomAPI_Shape::Comparator> MapShapeAndAncestors;
 
+/// Faces continuous to the selected ones, computed for an angle
+class FiltersPlugin_ContinuousFacesData : public ModelAPI_FilterData
+{
+public:
+  SetOfShapes myFaces;
+};
+
 //=================================================================================================
 static void mapEdgesAndFaces(const GeomShapePtr theShape, MapShapeAndAncestors& theMap)
 {
@@ -106,34 +113,6 @@ static void cacheContinuousFaces(const GeomShapePtr theTopLevelShape,
   }
 }
 
-//=================================================================================================
-static bool updateFaces(const AttributeSelectionListPtr& theList,
-                        SetOfShapes& theFaces)
-{
-  bool aNewCache = false;
-  if ((int)theFaces.size() != theList->size()) {
-    aNewCache = true;
-  } else {
-    for (int i = 0; i < theList->size(); i++) {
-      AttributeSelectionPtr aCurAttr = theList->value(i);
-      GeomShapePtr aFace = aCurAttr->value();
-      if (theFaces.empty() || theFaces.find(aFace) == theFaces.end()) {
-        aNewCache = true;
-        break;
-      }
-    }
-  }
-  if (aNewCache) {
-    theFaces.clear();
-    for (int i = 0; i < theList->size(); i++) {
-      AttributeSelectionPtr aCurAttr = theList->value(i);
-      GeomShapePtr aFace = aCurAttr->value();
-      theFaces.insert(aFace);
-    }
-  }
-  return aNewCache;
-}
-
 //=================================================================================================
 bool FiltersPlugin_ContinuousFaces::isSupported(GeomAPI_Shape::ShapeType theType) const
 {
@@ -156,29 +135,40 @@ bool FiltersPlugin_ContinuousFaces::isOk(const GeomShapePtr& theShape, const Res
     return false;
   double anAngle= aValue->value();
 
-  bool aNewCache = updateFaces(aList,
-                               const_cast<FiltersPlugin_ContinuousFaces*>(this)->myFaces);
-
-  if (aNewCache || fabs(myAngle - anAngle) > 1e-10 ) {
-    const_cast<FiltersPlugin_ContinuousFaces*>(this)->myAngle = anAngle;
-    const_cast<FiltersPlugin_ContinuousFaces*>(this)->myCachedShapes.clear();
+  // the selected faces and their bodies identify the cached continuous faces
+  SetOfShapes aFaces;
+  std::list<GeomShapePtr> aBaseShapes;
+  std::list<GeomShapePtr> aKeyShapes;
+  for (int i = 0; i < aList->size(); i++)
+  {
+    AttributeSelectionPtr aCurAttr = aList->value(i);
+    ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(aCurAttr->context(), true);
+    if (!aBaseResult.get()) {
+      aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(aCurAttr->context());
+      if (!aBaseResult.get())
+        return false;
+    }
+    GeomShapePtr aFace = aCurAttr->value();
+    aFaces.insert(aFace);
+    aBaseShapes.push_back(aBaseResult->shape());
+    aKeyShapes.push_back(aFace);
+    aKeyShapes.push_back(aBaseResult->shape());
   }
 
-  if (myCachedShapes.empty()) {
-    for (int i = 0; i < aList->size(); i++)
-    {
-      ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(aList->value(i)->context(), true);
-      if (!aBaseResult.get()) {
-        aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(aList->value(i)->context());
-        if (!aBaseResult.get())
-          return false;
-      }
-      cacheContinuousFaces(aBaseResult->shape(),
-                          const_cast<FiltersPlugin_ContinuousFaces*>(this)->myFaces,
-                          const_cast<FiltersPlugin_ContinuousFaces*>(this)->myCachedShapes,anAngle);
-    }
+  std::ostringstream aKey;
+  aKey.precision(17);
+  aKey << "ContinuousFaces_" << anAngle;
+  std::shared_ptr<FiltersPlugin_ContinuousFacesData> aCached =
+    std::dynamic_pointer_cast<FiltersPlugin_ContinuousFacesData>(
+    theArgs.cache()->find(aKey.str(), aKeyShapes));
+  if (!aCached) {
+    aCached.reset(new FiltersPlugin_ContinuousFacesData);
+    std::list<GeomShapePtr>::const_iterator aBaseIt = aBaseShapes.begin();
+    for (; aBaseIt != aBaseShapes.end(); ++aBaseIt)
+      cacheContinuousFaces(*aBaseIt, aFaces, aCached->myFaces, anAngle);
+    theArgs.cache()->store(aKey.str(), aKeyShapes, aCached);
   }
-  return myCachedShapes.find(theShape) != myCachedShapes.end();
+  return aCached->myFaces.find(theShape) != aCached->myFaces.end();
 }
 
 //=================================================================================================
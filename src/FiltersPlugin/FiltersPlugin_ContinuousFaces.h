@@ -36,9 +36,7 @@ typedef std::set<GeomShapePtr, GeomAPI_Shape::Comparator> SetOfShapes;
 class FiltersPlugin_ContinuousFaces : public ModelAPI_Filter
 {
 public:
-  FiltersPlugin_ContinuousFaces() : ModelAPI_Filter() {
-    myAngle = 0.0;
-  }
+  FiltersPlugin_ContinuousFaces() : ModelAPI_Filter() {}
 
   virtual const std::string& name() const {
     static const std::string kName("Continuous faces");
@@ -60,14 +58,6 @@ public:
 
   /// Initializes arguments of a filter.
   virtual void initAttributes(ModelAPI_FiltersArgs& theArguments) override;
-
-  private:
-    /// Original faces selected for filtering
-    SetOfShapes myFaces;
-    /// Shapes applicable for the filter
-    SetOfShapes myCachedShapes;
-    /// Angle tolerance
-    double myAngle;
 };
 
 #endif
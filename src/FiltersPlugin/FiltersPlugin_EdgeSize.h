@@ -49,6 +49,9 @@ public:
   virtual bool isOk(const GeomShapePtr& theShape, const ResultPtr&,
                     const ModelAPI_FiltersArgs& theArgs) const override;
 
+  /// Returns true: the length is computed from the checked edge only
+  virtual bool isThreadSafe() const override { return true; }
+
   /// Returns XML string which represents GUI of the filter
   virtual std::string xmlRepresentation() const override;
 
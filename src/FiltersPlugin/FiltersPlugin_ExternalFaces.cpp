@@ -24,6 +24,13 @@
 #include <TopExp.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 
+/// Solids of the body containing each face, computed once for all faces of the body
+class FiltersPlugin_FacesToSolids : public ModelAPI_FilterData
+{
+public:
+  TopTools_IndexedDataMapOfShapeListOfShape myMap;
+};
+
 bool FiltersPlugin_ExternalFaces::isSupported(GeomAPI_Shape::ShapeType theType) const
 {
   return theType == GeomAPI_Shape::FACE;
@@ -31,7 +38,7 @@ bool FiltersPlugin_ExternalFaces::isSupported(GeomAPI_Shape::ShapeType theType)
 
 bool FiltersPlugin_ExternalFaces::isOk(const GeomShapePtr& theShape,
                                        const ResultPtr& theResult,
-                                       const ModelAPI_FiltersArgs& /*theArgs*/) const
+                                       const ModelAPI_FiltersArgs& theArgs) const
 {
   if (!theShape->isFace())
     return false;
@@ -42,17 +49,30 @@ bool FiltersPlugin_ExternalFaces::isOk(const GeomShapePtr& theShape,
     return false;
 
   // check number of solids containing the face
-  ResultBodyPtr anOwner = ModelAPI_Tools::bodyOwner(theResult, true);
-  if (!anOwner) {
-    anOwner = std::dynamic_pointer_cast<ModelAPI_ResultBody>(theResult);
-    if (!anOwner)
-      return false;
+  GeomShapePtr anOwnerShape = theArgs.ownerShape();
+  if (!theArgs.owner()) { // not resolved by the factory: the check is in the main thread
+    ResultBodyPtr anOwner = ModelAPI_Tools::bodyOwner(theResult, true);
+    if (!anOwner) {
+      anOwner = std::dynamic_pointer_cast<ModelAPI_ResultBody>(theResult);
+      if (!anOwner)
+        return false;
+    }
+    anOwnerShape = anOwner->shape();
   }
-  GeomShapePtr anOwnerShape = anOwner->shape();
+  if (!anOwnerShape)
+    return false;
 
-  TopTools_IndexedDataMapOfShapeListOfShape aMapFS;
-  TopExp::MapShapesAndUniqueAncestors(anOwnerShape->impl<TopoDS_Shape>(),
-                                      TopAbs_FACE, TopAbs_SOLID, aMapFS);
-  const TopTools_ListOfShape& aSolids = aMapFS.FindFromKey(aShape);
+  static const std::string kFacesToSolids("FacesToSolids");
+  std::list<GeomShapePtr> aKeyShapes(1, anOwnerShape);
+  std::shared_ptr<FiltersPlugin_FacesToSolids> aMapFS =
+    std::dynamic_pointer_cast<FiltersPlugin_FacesToSolids>(
+    theArgs.cache()->find(kFacesToSolids, aKeyShapes));
+  if (!aMapFS) {
+    aMapFS.reset(new FiltersPlugin_FacesToSolids);
+    TopExp::MapShapesAndUniqueAncestors(anOwnerShape->impl<TopoDS_Shape>(),
+                                        TopAbs_FACE, TopAbs_SOLID, aMapFS->myMap);
+    theArgs.cache()->store(kFacesToSolids, aKeyShapes, aMapFS);
+  }
+  const TopTools_ListOfShape& aSolids = aMapFS->myMap.FindFromKey(aShape);
   return aSolids.Extent() <= 1;
 }
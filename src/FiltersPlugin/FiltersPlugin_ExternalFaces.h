@@ -49,6 +49,10 @@ public:
   virtual bool isOk(const GeomShapePtr& theShape,
                     const ResultPtr& theResult,
                     const ModelAPI_FiltersArgs& theArgs) const override;
+
+  /// Returns true: the filter has no state, the map of faces to solids is kept in the cache
+  /// and the owner body is resolved by the factory in the main thread
+  virtual bool isThreadSafe() const override { return true; }
 };
 
 #endif
\ No newline at end of file
@@ -36,9 +36,17 @@
 #include <map>
 #include <math.h>
 #include <iostream>
+#include <sstream>
 
 typedef std::map<GeomShapePtr, SetOfShapes, GeomAPI_Shape::Comparator> MapShapeAndAncestors;
 
+/// Feature edges of a body computed for an angle
+class FiltersPlugin_FeatureEdgesData : public ModelAPI_FilterData
+{
+public:
+  SetOfShapes myEdges;
+};
+
 //=================================================================================================
 static void mapEdgesAndFaces(const GeomShapePtr theShape, MapShapeAndAncestors& theMap)
 {
@@ -107,28 +115,34 @@ bool FiltersPlugin_FeatureEdges::isOk(const GeomShapePtr& theShape, const Result
   double anAngle = aValue->value();
 
   // check base result
-  ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(theResult, true);
-  if (!aBaseResult) {
-    aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(theResult);
-    if (!aBaseResult.get()) {
-      return false;
+  GeomShapePtr aBaseShape = theArgs.ownerShape();
+  if (!theArgs.owner()) { // not resolved by the factory: the check is in the main thread
+    ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(theResult, true);
+    if (!aBaseResult) {
+      aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(theResult);
+      if (!aBaseResult.get()) {
+        return false;
+      }
     }
+    aBaseShape = aBaseResult->shape();
   }
-  if (fabs(myAngle - anAngle) > 1e-10
-      || !myBaseShape
-      || !myBaseShape->isSame(aBaseResult->shape())) {
-    const_cast<FiltersPlugin_FeatureEdges*>(this)->myAngle = anAngle;
-    const_cast<FiltersPlugin_FeatureEdges*>(this)->myBaseShape = aBaseResult->shape();
-    const_cast<FiltersPlugin_FeatureEdges*>(this)->myCachedShapes.clear();
-  }
-
-  if (myCachedShapes.empty()) {
-
-    cacheFeatureEdge(aBaseResult->shape(),
-                     const_cast<FiltersPlugin_FeatureEdges*>(this)->myCachedShapes, anAngle);
+  if (!aBaseShape)
+    return false;
+  // feature edges are computed once for the body and the angle
+  std::ostringstream aKey;
+  aKey.precision(17);
+  aKey << "FeatureEdges_" << anAngle;
+  std::list<GeomShapePtr> aKeyShapes(1, aBaseShape);
+  std::shared_ptr<FiltersPlugin_FeatureEdgesData> aCached =
+    std::dynamic_pointer_cast<FiltersPlugin_FeatureEdgesData>(
+    theArgs.cache()->find(aKey.str(), aKeyShapes));
+  if (!aCached) {
+    aCached.reset(new FiltersPlugin_FeatureEdgesData);
+    cacheFeatureEdge(aBaseShape, aCached->myEdges, anAngle);
+    theArgs.cache()->store(aKey.str(), aKeyShapes, aCached);
   }
 
-  return myCachedShapes.find(theShape) != myCachedShapes.end();
+  return aCached->myEdges.find(theShape) != aCached->myEdges.end();
 }
 
 //=================================================================================================
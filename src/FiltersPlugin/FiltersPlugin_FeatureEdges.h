@@ -36,9 +36,7 @@ typedef std::set<GeomShapePtr, GeomAPI_Shape::Comparator> SetOfShapes;
 class FiltersPlugin_FeatureEdges : public ModelAPI_Filter
 {
 public:
-  FiltersPlugin_FeatureEdges() : ModelAPI_Filter() {
-    myAngle = 0.0;
-  }
+  FiltersPlugin_FeatureEdges() : ModelAPI_Filter() {}
 
   virtual const std::string& name() const {
     static const std::string kName("Feature edges");
@@ -61,13 +59,9 @@ public:
   /// Initializes arguments of a filter.
   virtual void initAttributes(ModelAPI_FiltersArgs& theArguments) override;
 
-  private:
-    /// Shapes applicable for the filter
-    SetOfShapes myCachedShapes;
-    /// Angle tolerance
-    double myAngle;
-    /// the base shape
-    GeomShapePtr myBaseShape;
+  /// Returns true: the filter has no state, the feature edges are kept in the cache
+  /// and the owner body is resolved by the factory in the main thread
+  virtual bool isThreadSafe() const override { return true; }
 };
 
 #endif
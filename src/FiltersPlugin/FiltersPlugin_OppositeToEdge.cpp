@@ -33,6 +33,13 @@
 
 typedef std::map<GeomShapePtr, SetOfShapes, GeomAPI_Shape::Comparator> MapShapeAndAncestors;
 
+/// Edges opposite to the selected one in quadrangular faces of the body
+class FiltersPlugin_OppositeEdgesData : public ModelAPI_FilterData
+{
+public:
+  SetOfShapes myEdges;
+};
+
 static void mapEdgesAndFaces(const GeomShapePtr theShape, MapShapeAndAncestors& theMap)
 {
   GeomAPI_ShapeExplorer aFExp(theShape, GeomAPI_Shape::FACE);
@@ -140,25 +147,28 @@ bool FiltersPlugin_OppositeToEdge::isOk(const GeomShapePtr& theShape, const Resu
   if (!aList.get())
     return false;
   GeomShapePtr anEdge = aList->value();
-  if (!myOriginalEdge || !myOriginalEdge->isSame(anEdge)) {
-    // new edge is selected, need to update the cache
-    const_cast<FiltersPlugin_OppositeToEdge*>(this)->myOriginalEdge = anEdge;
-    const_cast<FiltersPlugin_OppositeToEdge*>(this)->myCachedShapes.clear();
+  ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(aList->context(), true);
+  if (!aBaseResult.get()) {
+    aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(aList->context());
+    if (!aBaseResult.get())
+      return false;
   }
 
-  if (myCachedShapes.empty()) {
-    ResultBodyPtr aBaseResult = ModelAPI_Tools::bodyOwner(aList->context(), true);
-    if (!aBaseResult.get()) {
-      aBaseResult = std::dynamic_pointer_cast<ModelAPI_ResultBody>(aList->context());
-      if (!aBaseResult.get())
-        return false;
-    }
-
-    cacheOppositeEdges(aBaseResult->shape(), anEdge,
-        const_cast<FiltersPlugin_OppositeToEdge*>(this)->myCachedShapes);
+  // opposite edges are computed once for the selected edge and its body
+  static const std::string kOppositeEdges("OppositeToEdge");
+  std::list<GeomShapePtr> aKeyShapes;
+  aKeyShapes.push_back(anEdge);
+  aKeyShapes.push_back(aBaseResult->shape());
+  std::shared_ptr<FiltersPlugin_OppositeEdgesData> aCached =
+    std::dynamic_pointer_cast<FiltersPlugin_OppositeEdgesData>(
+    theArgs.cache()->find(kOppositeEdges, aKeyShapes));
+  if (!aCached) {
+    aCached.reset(new FiltersPlugin_OppositeEdgesData);
+    cacheOppositeEdges(aBaseResult->shape(), anEdge, aCached->myEdges);
+    theArgs.cache()->store(kOppositeEdges, aKeyShapes, aCached);
   }
 
-  return myCachedShapes.find(theShape) != myCachedShapes.end();
+  return aCached->myEdges.find(theShape) != aCached->myEdges.end();
 }
 
 std::string FiltersPlugin_OppositeToEdge::xmlRepresentation() const
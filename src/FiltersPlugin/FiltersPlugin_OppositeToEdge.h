@@ -58,12 +58,6 @@ public:
 
   /// Initializes arguments of a filter.
   virtual void initAttributes(ModelAPI_FiltersArgs& theArguments) override;
-
-private:
-  /// Original edge selected for filtering
-  GeomShapePtr myOriginalEdge;
-  /// Shapes applicable for the filter
-  SetOfShapes myCachedShapes;
 };
 
 #endif
\ No newline at end of file
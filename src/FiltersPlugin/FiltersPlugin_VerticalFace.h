@@ -47,6 +47,9 @@ public:
   /// \param theArgs arguments of the filter
   virtual bool isOk(const GeomShapePtr& theShape, const ResultPtr&,
                     const ModelAPI_FiltersArgs& theArgs) const override;
+
+  /// Returns true: only the geometry of the checked face is used
+  virtual bool isThreadSafe() const override { return true; }
 };
 
 #endif
\ No newline at end of file
@@ -50,6 +50,9 @@ public:
   virtual bool isOk(const GeomShapePtr& theShape, const ResultPtr&,
                     const ModelAPI_FiltersArgs& theArgs) const override;
 
+  /// Returns true: the volume is computed from the checked solid only
+  virtual bool isThreadSafe() const override { return true; }
+
   /// Returns XML string which represents GUI of the filter
   virtual std::string xmlRepresentation() const override;
 
@@ -0,0 +1,75 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+
+"""
+    Test the selection by filters checking several bodies in parallel gives the same
+    shapes as the check of each shape in the main thread.
+"""
+
+from salome.shaper import model
+from GeomAPI import *
+from ModelAPI import *
+
+def uniqueSubShapes(theShape, theType):
+  aShapes = []
+  exp = GeomAPI_ShapeExplorer(theShape, theType)
+  while exp.more():
+    if not any(aShape.isSame(exp.current()) for aShape in aShapes):
+      aShapes.append(exp.current())
+    exp.next()
+  return aShapes
+
+# returns the number of sub-shapes of the bodies accepted by the filters in the main thread
+def nbValid(theFilters, theBodies, theType):
+  aFactory = ModelAPI_Session.get().filters()
+  aNb = 0
+  for aBody in theBodies:
+    for aShape in uniqueSubShapes(aBody.shape(), theType):
+      if aFactory.isValid(theFilters.feature(), aBody, aShape):
+        aNb += 1
+  return aNb
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Box_2 = model.addBox(Part_1_doc, 10, 10, 10)
+Translation_1 = model.addTranslation(Part_1_doc, [model.selection("SOLID", "Box_2_1")], axis = model.selection("EDGE", "PartSet/OX"), distance = 5, keepSubResults = True)
+# compsolid of 3 solids with 2 internal faces: the filters use the whole body, not a sub-result
+Partition_1 = model.addPartition(Part_1_doc, [model.selection("SOLID", "Box_1_1"), model.selection("SOLID", "Translation_1_1")], keepSubResults = True)
+Box_3 = model.addBox(Part_1_doc, 20, 20, 20)
+model.end()
+
+aBodies = [Partition_1.result().resultSubShapePair()[0], Box_3.result().resultSubShapePair()[0]]
+
+model.begin()
+Filters = model.filters(Part_1_doc, [model.addFilter(name = "ExternalFaces")])
+nFaces = len(Filters.select("FACE"))
+model.end()
+assert nFaces == 20, "Wrong number of external faces: {}, expected 20".format(nFaces)
+nFacesRef = nbValid(Filters, aBodies, GeomAPI_Shape.FACE)
+assert nFaces == nFacesRef, "Parallel selection gives {} faces, the check of each face {}".format(nFaces, nFacesRef)
+
+model.begin()
+Filters = model.filters(Part_1_doc, [model.addFilter(name = "FeatureEdges", args = [ 5.0 ])])
+nEdges = len(Filters.select("EDGE"))
+model.end()
+nEdgesRef = nbValid(Filters, aBodies, GeomAPI_Shape.EDGE)
+assert nEdges == nEdgesRef, "Parallel selection gives {} edges, the check of each edge {}".format(nEdges, nEdgesRef)
+assert nEdges > 12, "Wrong number of feature edges: {}".format(nEdges)
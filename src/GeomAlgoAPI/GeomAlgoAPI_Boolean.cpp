@@ -20,10 +20,14 @@
 #include "GeomAlgoAPI_Boolean.h"
 
 #include <GeomAlgoAPI_DFLoader.h>
+#include <GeomAlgoAPI_PaveFillerCache.h>
 #include <GeomAlgoAPI_ShapeTools.h>
 
 #include <BOPAlgo_BOP.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopExp_Explorer.hxx>
 
@@ -111,18 +115,31 @@ void GeomAlgoAPI_Boolean::build(const ListOfShape& theObjects,
   aBuilder->SetArguments(anObjects);
   aBuilder->SetTools(aTools);
 
-  // Set parallel processing mode (default is false)
-  Standard_Boolean bRunParallel = Standard_True;
-  aBuilder->SetRunParallel(bRunParallel);
-
-  // Set fuzzy value to eliminate thin results
+  // Set parallel processing mode and fuzzy value to eliminate thin results
   // => Either use the value set by the user (if positive)
+  // => or the default value of the policy
   // => or use the old default value of 1.e-5
-  Standard_Real aFuzzy = (theFuzzy > 0 ? theFuzzy : 1.e-5);
-  aBuilder->SetFuzzyValue(aFuzzy);
+  double aFuzzy = GeomAlgoAPI_Tools::BOP_Policy::fuzzy(theFuzzy, 1.e-5);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aBuilder, aFuzzy);
+
+  // Intersection of all arguments, shared with other operations on the same shapes
+  TopTools_ListOfShape anArguments;
+  TopTools_MapOfShape aFence;
+  TopTools_ListIteratorOfListOfShape anArgIt(anObjects);
+  for (; anArgIt.More(); anArgIt.Next()) {
+    if (aFence.Add(anArgIt.Value()))
+      anArguments.Append(anArgIt.Value());
+  }
+  for (anArgIt.Initialize(aTools); anArgIt.More(); anArgIt.Next()) {
+    if (aFence.Add(anArgIt.Value()))
+      anArguments.Append(anArgIt.Value());
+  }
+  myFiller = GeomAlgoAPI_PaveFillerCache::filler(anArguments, aFuzzy);
+  if (!myFiller)
+    return;
 
   // Building and getting result.
-  aBuilder->Perform();
+  aBuilder->PerformWithFiller(*myFiller);
   if (aBuilder->HasErrors())
     return;
   TopoDS_Shape aResult = aBuilder->Shape();
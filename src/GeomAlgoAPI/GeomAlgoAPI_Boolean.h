@@ -26,6 +26,8 @@
 
 #include <GeomAPI_Shape.h>
 
+class BOPAlgo_PaveFiller;
+
 /// \class GeomAlgoAPI_Boolean
 /// \ingroup DataAlgo
 /// \brief Allows to perform of boolean operations
@@ -80,6 +82,9 @@ private:
              const ListOfShape& theTools,
              const GeomAlgoAPI_Tools::BOPType theOperationType,
              const double theFuzzy);
+
+  /// Intersection of the arguments, the builder refers to it
+  std::shared_ptr<BOPAlgo_PaveFiller> myFiller;
 };
 
 #endif
@@ -19,6 +19,7 @@
 
 #include <GeomAlgoAPI_Defeaturing.h>
 #include <GeomAlgoAPI_DFLoader.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <BRepAlgoAPI_Defeaturing.hxx>
 
@@ -36,7 +37,7 @@ void GeomAlgoAPI_Defeaturing::build(const GeomShapePtr& theBaseSolid,
 
   BRepAlgoAPI_Defeaturing* aDefeaturing = new BRepAlgoAPI_Defeaturing;
   aDefeaturing->SetShape(theBaseSolid->impl<TopoDS_Shape>());
-  aDefeaturing->SetRunParallel(Standard_True);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aDefeaturing);
 
   // collect faces to remove
   TopTools_ListOfShape aFaces;
@@ -20,6 +20,8 @@
 #include "GeomAlgoAPI_Intersection.h"
 
 #include <GeomAlgoAPI_DFLoader.h>
+#include <GeomAlgoAPI_PaveFillerCache.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BOPAlgo_Section.hxx>
@@ -27,17 +29,10 @@
 
 //==================================================================================================
 GeomAlgoAPI_Intersection::GeomAlgoAPI_Intersection(const ListOfShape& theObjects, const double theFuzzy)
-  : myFiller(0)
 {
   build(theObjects, theFuzzy);
 }
 
-//==================================================================================================
-GeomAlgoAPI_Intersection::~GeomAlgoAPI_Intersection() {
-  if (myFiller)
-    delete (BOPAlgo_PaveFiller*)myFiller;
-}
-
 //==================================================================================================
 void GeomAlgoAPI_Intersection::build(const ListOfShape& theObjects, const double theFuzzy)
 {
@@ -60,33 +55,20 @@ void GeomAlgoAPI_Intersection::build(const ListOfShape& theObjects, const double
     }
   }
 
-  BOPAlgo_PaveFiller* aDSFiller = new BOPAlgo_PaveFiller;
-  myFiller = aDSFiller;
-  aDSFiller->SetArguments(anObjects);
-
-  aDSFiller->SetRunParallel(false);
-  aDSFiller->SetNonDestructive(false);
-  aDSFiller->SetGlue(BOPAlgo_GlueOff);
-  if (theFuzzy > 0) aDSFiller->SetFuzzyValue(theFuzzy);
-
-  // optimization for the issue #2399
-  BOPAlgo_SectionAttribute theSecAttr(Standard_True,
-                                      Standard_True,
-                                      Standard_True);
-  aDSFiller->SetSectionAttribute(theSecAttr);
-
-  aDSFiller->Perform();
-  if (aDSFiller->HasErrors()) {
+  // Intersection of the objects, shared with other operations on the same shapes.
+  // The approximation of section curves and their p-curves on both faces
+  // (the default section attributes) are required by the issue #2399.
+  double aFuzzy = GeomAlgoAPI_Tools::BOP_Policy::fuzzy(theFuzzy);
+  myFiller = GeomAlgoAPI_PaveFillerCache::filler(anObjects, aFuzzy);
+  if (!myFiller) {
     return;
   }
 
   anOperation->SetArguments(anObjects);
-  anOperation->SetRunParallel(false);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*anOperation, aFuzzy);
   anOperation->SetCheckInverted(true);
-  if (theFuzzy > 0) anOperation->SetFuzzyValue(theFuzzy);
 
-  anOperation->PerformWithFiller(*aDSFiller); // it references a filler fields, so keep the filler
-  myFiller = 0;
+  anOperation->PerformWithFiller(*myFiller); // it references a filler fields, so keep the filler
   if(anOperation->HasErrors()) {
     return;
   }
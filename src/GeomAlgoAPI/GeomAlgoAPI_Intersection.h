@@ -25,12 +25,15 @@
 
 #include <GeomAPI_Shape.h>
 
+class BOPAlgo_PaveFiller;
+
 /// \class GeomAlgoAPI_Intersection
 /// \ingroup DataAlgo
 /// \brief Performs the intersection operations.
 class GeomAlgoAPI_Intersection : public GeomAlgoAPI_MakeShape
 {
-  void* myFiller; ///< store filler to avoid memory leaks
+  /// Intersection of the objects, the section algorithm refers to it
+  std::shared_ptr<BOPAlgo_PaveFiller> myFiller;
 public:
   /// \brief Constructor.
   /// \param[in] theObjects list of objects.
@@ -40,9 +43,6 @@ public:
   GEOMALGOAPI_EXPORT GeomAlgoAPI_Intersection(const ListOfShape& theObjects,
       const double theFuzzy = 1.e-8);
 
-  /// Destructor to erase the filler
-  GEOMALGOAPI_EXPORT virtual ~GeomAlgoAPI_Intersection();
-
 private:
   /// Builds resulting shape.
   void build(const ListOfShape& theObjects, const double theFuzzy);
@@ -22,6 +22,7 @@
 #include <GeomAPI_ShapeExplorer.h>
 
 #include <GeomAlgoAPI_ShapeTools.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <BOPAlgo_MakerVolume.hxx>
 
@@ -70,6 +71,7 @@ void GeomAlgoAPI_MakeVolume::build(const ListOfShape& theFaces)
   aVolumeMaker->SetIntersect(true); // split edges and faces
   aVolumeMaker->SetAvoidInternalShapes(myAvoidInternal);
   aVolumeMaker->SetGlue(BOPAlgo_GlueOff);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aVolumeMaker);
 
   // building and getting result
   aVolumeMaker->Perform();
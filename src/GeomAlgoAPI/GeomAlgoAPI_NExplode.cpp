@@ -27,6 +27,7 @@
 #include <BRepBndLib.hxx>
 #include <BRepGProp.hxx>
 #include <GProp_GProps.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
@@ -93,27 +94,60 @@ namespace NExplodeTools
                                GeomAPI_Shape::Equal > DataMapOfShapeDouble;
 
     CompareShapes(void(*convertPoint)(gp_Pnt&))
-      : myConvertPoint(convertPoint) {}
+      : myMap(new DataMapOfShapeDouble), myConvertPoint(convertPoint) {}
 
     bool operator() (const GeomShapePtr& lhs, const GeomShapePtr& rhs);
 
-    DataMapOfShapeDouble myMap;
+    /// Computes in parallel the centers of mass of all shapes before the sorting
+    void prepare(const std::vector<GeomShapePtr>& theShapes);
+
+    // shared between copies of the comparator made by the sorting algorithm
+    std::shared_ptr<DataMapOfShapeDouble> myMap;
+    void(*myConvertPoint)(gp_Pnt&);
+  };
+
+  /// Functor for the parallel computation of the centers of mass
+  class ShapeToDoubleFunctor
+  {
+  public:
+    ShapeToDoubleFunctor(const std::vector<GeomShapePtr>& theShapes,
+                         std::vector<std::pair<GeomPointPtr, double> >& theValues,
+                         void(*convertPoint)(gp_Pnt&))
+      : myShapes(theShapes), myValues(theValues), myConvertPoint(convertPoint) {}
+
+    void operator()(const int theIndex) const
+    {
+      myValues[theIndex] = ShapeToDouble(myShapes[theIndex], myConvertPoint);
+    }
+
+  private:
+    const std::vector<GeomShapePtr>& myShapes;
+    std::vector<std::pair<GeomPointPtr, double> >& myValues;
     void(*myConvertPoint)(gp_Pnt&);
   };
 }
 
+void NExplodeTools::CompareShapes::prepare(const std::vector<GeomShapePtr>& theShapes)
+{
+  std::vector<std::pair<GeomPointPtr, double> > aValues(theShapes.size());
+  OSD_Parallel::For(0, (int)theShapes.size(),
+                    ShapeToDoubleFunctor(theShapes, aValues, myConvertPoint));
+  for (size_t anIndex = 0; anIndex < theShapes.size(); ++anIndex)
+    myMap->insert(std::make_pair(theShapes[anIndex], aValues[anIndex]));
+}
+
 bool NExplodeTools::CompareShapes::operator() (const GeomShapePtr& lhs, const GeomShapePtr& rhs)
 {
-  if (myMap.find(lhs) == myMap.end()) {
-    myMap[lhs] = ShapeToDouble(lhs, myConvertPoint);
+  if (myMap->find(lhs) == myMap->end()) {
+    (*myMap)[lhs] = ShapeToDouble(lhs, myConvertPoint);
   }
 
-  if (myMap.find(rhs) == myMap.end()) {
-    myMap[rhs] = ShapeToDouble(rhs, myConvertPoint);
+  if (myMap->find(rhs) == myMap->end()) {
+    (*myMap)[rhs] = ShapeToDouble(rhs, myConvertPoint);
   }
 
-  const std::pair<GeomPointPtr, double>& val1 = myMap.at(lhs);
-  const std::pair<GeomPointPtr, double>& val2 = myMap.at(rhs);
+  const std::pair<GeomPointPtr, double>& val1 = myMap->at(lhs);
+  const std::pair<GeomPointPtr, double>& val2 = myMap->at(rhs);
 
   double tol = 10.0 * Precision::Confusion();
   bool exchange = Standard_False;
@@ -187,23 +221,19 @@ GeomAlgoAPI_NExplode::GeomAlgoAPI_NExplode(const ListOfShape& theShapes,
   reorder(theOrder);
 }
 
-int GeomAlgoAPI_NExplode::index(const GeomShapePtr theSubShape)
+int GeomAlgoAPI_NExplode::index(const GeomShapePtr theSubShape) const
 {
-  std::vector<GeomShapePtr>::iterator anIter = mySorted.begin();
-  for(int anIndex = 1; anIter != mySorted.end(); anIter++, anIndex++) {
-    if ((*anIter)->isSame(theSubShape))
-      return anIndex;
-  }
-  return 0; // not found
+  if (!theSubShape.get() || theSubShape->isNull())
+    return 0;
+  std::unordered_map<GeomShapePtr, int, GeomAPI_Shape::Hash, GeomAPI_Shape::Equal>::const_iterator
+    aFound = myIndices.find(theSubShape);
+  return aFound == myIndices.end() ? 0 : aFound->second; // 0 if not found
 }
 
-GeomShapePtr GeomAlgoAPI_NExplode::shape(const int theIndex)
+GeomShapePtr GeomAlgoAPI_NExplode::shape(const int theIndex) const
 {
-  std::vector<GeomShapePtr>::iterator anIter = mySorted.begin();
-  for(int anIndex = 1; anIter != mySorted.end(); anIter++, anIndex++) {
-    if (anIndex == theIndex)
-      return *anIter;
-  }
+  if (theIndex >= 1 && theIndex <= (int)mySorted.size())
+    return mySorted[theIndex - 1];
   return GeomShapePtr(); // not found
 }
 
@@ -211,5 +241,12 @@ void GeomAlgoAPI_NExplode::reorder(const ShapeOrder theNewOrder)
 {
   NExplodeTools::CompareShapes shComp(
       theNewOrder == ORDER_BY_HASH_VALUE ? NExplodeTools::pointToDouble : NExplodeTools::dummy);
+  shComp.prepare(mySorted);
   std::stable_sort(mySorted.begin(), mySorted.end(), shComp);
+
+  myIndices.clear();
+  std::vector<GeomShapePtr>::iterator anIter = mySorted.begin();
+  for(int anIndex = 1; anIter != mySorted.end(); anIter++, anIndex++) {
+    myIndices.insert(std::make_pair(*anIter, anIndex)); // keeps the first index of same shapes
+  }
 }
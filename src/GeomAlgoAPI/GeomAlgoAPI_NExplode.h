@@ -24,6 +24,7 @@
 
 #include <GeomAPI_Shape.h>
 
+#include <unordered_map>
 #include <vector>
 
 /// \class GeomAlgoAPI_NExplode
@@ -51,15 +52,17 @@ public:
                                            const ShapeOrder theOrder = ORDER_BY_MIDDLE_POINT);
 
    /// Returns an index (started from one) of sub-shape in the sorted list. Returns 0 if not found.
-   GEOMALGOAPI_EXPORT int index(const GeomShapePtr theSubShape);
+   GEOMALGOAPI_EXPORT int index(const GeomShapePtr theSubShape) const;
    /// Returns a shape by an index (started from one). Returns null if not found.
-   GEOMALGOAPI_EXPORT GeomShapePtr shape(const int theIndex);
+   GEOMALGOAPI_EXPORT GeomShapePtr shape(const int theIndex) const;
 
    /// Reorder the shapes
    GEOMALGOAPI_EXPORT void reorder(const ShapeOrder theNewOrder);
 
 protected:
   std::vector<GeomShapePtr> mySorted;
+  /// index (started from one) of each shape in mySorted: the first one if the same shapes
+  std::unordered_map<GeomShapePtr, int, GeomAPI_Shape::Hash, GeomAPI_Shape::Equal> myIndices;
 };
 
 #endif
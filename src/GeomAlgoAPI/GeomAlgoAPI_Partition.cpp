@@ -20,11 +20,14 @@
 #include "GeomAlgoAPI_Partition.h"
 
 #include <GeomAlgoAPI_DFLoader.h>
+#include <GeomAlgoAPI_PaveFillerCache.h>
 #include <GeomAlgoAPI_ShapeTools.h>
 #include <GeomAlgoAPI_SortListOfShapes.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <GEOMAlgo_Splitter.hxx>
 
+#include <BOPAlgo_PaveFiller.hxx>
 #include <NCollection_Vector.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS_Builder.hxx>
@@ -164,6 +167,7 @@ void GeomAlgoAPI_Partition::build(const ListOfShape& theObjects,
   this->setBuilderType(OCCT_BOPAlgo_Builder);
 
   TopTools_MapOfShape ShapesMap;
+  TopTools_ListOfShape anArguments; // objects and tools to intersect
   // Getting objects.
   for(ListOfShape::const_iterator anObjectsIt = theObjects.begin();
       anObjectsIt != theObjects.end();
@@ -178,6 +182,7 @@ void GeomAlgoAPI_Partition::build(const ListOfShape& theObjects,
       const TopoDS_Shape& aSimpleSh = aSimpleIter.Value();
       if (ShapesMap.Add(aSimpleSh)) {
         anOperation->AddArgument(aSimpleSh);
+        anArguments.Append(aSimpleSh);
       }
     }
   }
@@ -194,18 +199,22 @@ void GeomAlgoAPI_Partition::build(const ListOfShape& theObjects,
       const TopoDS_Shape& aSimpleSh = aSimpleIter.Value();
       if (ShapesMap.Add(aSimpleSh)) {
         anOperation->AddTool(aSimpleSh);
+        anArguments.Append(aSimpleSh);
       }
     }
   }
 
-  // Set parallel processing mode (default is false)
-  Standard_Boolean bRunParallel = Standard_True;
-  anOperation->SetRunParallel(bRunParallel);
+  // Set parallel processing mode and fuzzy value
+  double aFuzzy = GeomAlgoAPI_Tools::BOP_Policy::fuzzy(theFuzzy);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*anOperation, aFuzzy);
 
-  if (theFuzzy > 0) anOperation->SetFuzzyValue(theFuzzy);
+  // Intersection of objects and tools, shared with other operations on the same shapes
+  myFiller = GeomAlgoAPI_PaveFillerCache::filler(anArguments, aFuzzy);
+  if (!myFiller)
+    return;
 
   // Building and getting result.
-  anOperation->Perform();
+  anOperation->PerformWithFiller(*myFiller);
   if (anOperation->HasErrors())
     return;
   TopoDS_Shape aResult = anOperation->Shape();
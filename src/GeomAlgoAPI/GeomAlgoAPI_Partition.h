@@ -25,6 +25,8 @@
 
 #include <GeomAPI_Shape.h>
 
+class BOPAlgo_PaveFiller;
+
 /// \class GeomAlgoAPI_Partition
 /// \ingroup DataAlgo
 /// \brief Allows to perform of partition operations
@@ -46,6 +48,9 @@ private:
   void build(const ListOfShape& theObjects,
              const ListOfShape& theTools,
              const double theFuzzy);
+
+  /// Intersection of the arguments, the builder refers to it
+  std::shared_ptr<BOPAlgo_PaveFiller> myFiller;
 };
 
 #endif
@@ -20,7 +20,9 @@
 #include "GeomAlgoAPI_PaveFiller.h"
 
 #include <GeomAlgoAPI_DFLoader.h>
+#include <GeomAlgoAPI_PaveFillerCache.h>
 #include <GeomAlgoAPI_ShapeTools.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
@@ -42,7 +44,6 @@ void GeomAlgoAPI_PaveFiller::build(const ListOfShape& theListOfShape,
                                    const bool theIsMakeCompSolids,
                                    const double theFuzzy)
 {
-  BOPAlgo_PaveFiller* aPaveFiller = new BOPAlgo_PaveFiller;
   TopTools_ListOfShape aListOfShape;
   for(ListOfShape::const_iterator
     anIt = theListOfShape.cbegin(); anIt != theListOfShape.cend(); anIt++) {
@@ -55,18 +56,17 @@ void GeomAlgoAPI_PaveFiller::build(const ListOfShape& theListOfShape,
       aListOfShape.Append(aShape);
     }
   }
-  aPaveFiller->SetArguments(aListOfShape);
-  if (theFuzzy > 0) aPaveFiller->SetFuzzyValue(theFuzzy);
-  aPaveFiller->Perform();
-  if (aPaveFiller->HasErrors())
+  double aFuzzy = GeomAlgoAPI_Tools::BOP_Policy::fuzzy(theFuzzy);
+  myFiller = GeomAlgoAPI_PaveFillerCache::filler(aListOfShape, aFuzzy);
+  if (!myFiller)
     return;
 
   BOPAlgo_Builder* aBuilder = new BOPAlgo_Builder();
   this->setImpl(aBuilder);
   this->setBuilderType(OCCT_BOPAlgo_Builder);
   aBuilder->SetArguments(aListOfShape);
-  if (theFuzzy > 0) aBuilder->SetFuzzyValue(theFuzzy);
-  aBuilder->PerformWithFiller(*aPaveFiller);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aBuilder, aFuzzy);
+  aBuilder->PerformWithFiller(*myFiller);
   if (aBuilder->HasErrors())
     return;
 
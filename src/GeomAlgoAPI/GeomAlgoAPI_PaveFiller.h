@@ -25,6 +25,8 @@
 
 #include <GeomAPI_Shape.h>
 
+class BOPAlgo_PaveFiller;
+
 /// \class GeomAlgoAPI_PaveFiller
 /// \ingroup DataAlgo
 /// \brief Finds the common parts from the list of shapes and
@@ -45,6 +47,9 @@ public:
 private:
   /// Builds resulting shape.
   void build(const ListOfShape& theListOfShape, const bool theIsMakeCompSolids, const double theFuzzy);
+
+  /// Intersection of the shapes, the builder refers to it
+  std::shared_ptr<BOPAlgo_PaveFiller> myFiller;
 };
 
 #endif
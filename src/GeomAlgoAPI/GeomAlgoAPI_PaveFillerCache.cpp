@@ -0,0 +1,118 @@
+// Copyright (C) 2014-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "GeomAlgoAPI_PaveFillerCache.h"
+
+#include <GeomAlgoAPI_Tools.h>
+
+#include <BOPAlgo_PaveFiller.hxx>
+#include <TopTools_ListIteratorOfListOfShape.hxx>
+
+#include <list>
+#include <mutex>
+
+/// Intersection of the arguments computed with the given parameters
+struct GeomAlgoAPI_PaveFillerEntry
+{
+  TopTools_ListOfShape myArguments; ///< keeps the shapes, so, they can not be replaced by others
+  double myFuzzy;
+  BOPAlgo_GlueEnum myGlue;
+  std::shared_ptr<BOPAlgo_PaveFiller> myFiller;
+};
+
+/// Number of pave fillers kept by the cache: they contain all the intersections of the arguments
+static const size_t THE_FILLERS_CACHE_SIZE = 4;
+
+/// Stored pave fillers, the most recently used first
+static std::list<GeomAlgoAPI_PaveFillerEntry>& fillers()
+{
+  static std::list<GeomAlgoAPI_PaveFillerEntry> aFillers;
+  return aFillers;
+}
+
+/// Protects the stored pave fillers, features may be computed concurrently
+static std::mutex& fillersMutex()
+{
+  static std::mutex aMutex;
+  return aMutex;
+}
+
+/// Returns true if the lists contain the same shapes in the same order
+static bool isSameArguments(const TopTools_ListOfShape& theList1,
+                            const TopTools_ListOfShape& theList2)
+{
+  if (theList1.Extent() != theList2.Extent())
+    return false;
+  TopTools_ListIteratorOfListOfShape anIt1(theList1), anIt2(theList2);
+  for (; anIt1.More(); anIt1.Next(), anIt2.Next()) {
+    if (!anIt1.Value().IsEqual(anIt2.Value()))
+      return false;
+  }
+  return true;
+}
+
+//=================================================================================================
+std::shared_ptr<BOPAlgo_PaveFiller> GeomAlgoAPI_PaveFillerCache::filler(
+    const TopTools_ListOfShape& theArguments,
+    const double theFuzzy,
+    const BOPAlgo_GlueEnum theGlue)
+{
+  {
+    std::lock_guard<std::mutex> aLock(fillersMutex());
+    std::list<GeomAlgoAPI_PaveFillerEntry>& aFillers = fillers();
+    std::list<GeomAlgoAPI_PaveFillerEntry>::iterator anIt = aFillers.begin();
+    for (; anIt != aFillers.end(); ++anIt) {
+      if (anIt->myFuzzy == theFuzzy && anIt->myGlue == theGlue &&
+          isSameArguments(anIt->myArguments, theArguments)) {
+        aFillers.splice(aFillers.begin(), aFillers, anIt);
+        return aFillers.front().myFiller;
+      }
+    }
+  }
+
+  // the intersection is computed outside of the lock: it is the longest part of the operation
+  std::shared_ptr<BOPAlgo_PaveFiller> aFiller(new BOPAlgo_PaveFiller);
+  aFiller->SetArguments(theArguments);
+  aFiller->SetNonDestructive(false);
+  aFiller->SetGlue(theGlue);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aFiller, theFuzzy);
+  aFiller->Perform();
+  if (aFiller->HasErrors())
+    return std::shared_ptr<BOPAlgo_PaveFiller>();
+
+  GeomAlgoAPI_PaveFillerEntry anEntry;
+  anEntry.myArguments = theArguments;
+  anEntry.myFuzzy = theFuzzy;
+  anEntry.myGlue = theGlue;
+  anEntry.myFiller = aFiller;
+
+  std::lock_guard<std::mutex> aLock(fillersMutex());
+  std::list<GeomAlgoAPI_PaveFillerEntry>& aFillers = fillers();
+  aFillers.push_front(anEntry);
+  if (aFillers.size() > THE_FILLERS_CACHE_SIZE)
+    aFillers.pop_back();
+  return aFiller;
+}
+
+//=================================================================================================
+void GeomAlgoAPI_PaveFillerCache::clear()
+{
+  std::lock_guard<std::mutex> aLock(fillersMutex());
+  fillers().clear();
+}
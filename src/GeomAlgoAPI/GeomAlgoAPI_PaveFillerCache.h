@@ -0,0 +1,57 @@
+// Copyright (C) 2014-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef GeomAlgoAPI_PaveFillerCache_H_
+#define GeomAlgoAPI_PaveFillerCache_H_
+
+#include <GeomAlgoAPI.h>
+
+#include <BOPAlgo_GlueEnum.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <memory>
+
+class BOPAlgo_PaveFiller;
+
+/// \class GeomAlgoAPI_PaveFillerCache
+/// \ingroup DataAlgo
+/// \brief Intersections of the arguments of boolean operations, shared between
+///  the operations on the same shapes (for example, a feature and its preview,
+///  or several operations of a feature on the same objects and tools).
+class GeomAlgoAPI_PaveFillerCache
+{
+public:
+  /// \brief Returns the pave filler with the performed intersection of the arguments.
+  /// The pave filler computed for the same arguments (in the same order), fuzzy value and
+  /// glue mode is reused while it is one of the last computed ones.
+  /// The builders using the returned pave filler must keep it while they are used.
+  /// \param[in] theArguments shapes to intersect.
+  /// \param[in] theFuzzy additional tolerance value, not used if not positive.
+  /// \param[in] theGlue gluing mode of the arguments.
+  /// \return the pave filler or null if the intersection failed.
+  GEOMALGOAPI_EXPORT static std::shared_ptr<BOPAlgo_PaveFiller> filler(
+      const TopTools_ListOfShape& theArguments,
+      const double theFuzzy,
+      const BOPAlgo_GlueEnum theGlue = BOPAlgo_GlueOff);
+
+  /// Releases all stored pave fillers
+  GEOMALGOAPI_EXPORT static void clear();
+};
+
+#endif
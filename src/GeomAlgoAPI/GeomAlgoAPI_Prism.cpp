@@ -33,6 +33,7 @@
 #include <GeomAlgoAPI_Offset.h>
 #include <GeomAlgoAPI_Partition.h>
 #include <GeomAlgoAPI_ShapeTools.h>
+#include <GeomAlgoAPI_Tools.h>
 #include <GeomAlgoAPI_Translation.h>
 
 #include <Bnd_Box.hxx>
@@ -95,6 +96,10 @@ static void storeGenerationHistory(GeomAlgoAPI_Prism* thePrismAlgo,
                                    const TopoDS_Face& theToFace,
                                    const TopoDS_Face& theFromFace);
 
+/// Creates the cut of theTool from theObject with the options of the boolean operations.
+/// The operation is not built.
+static BRepAlgoAPI_Cut* makeCut(const TopoDS_Shape& theObject, const TopoDS_Shape& theTool);
+
 static GeomShapePtr toShape(const TopoDS_Shape& theShape)
 {
   GeomShapePtr aShape(new GeomAPI_Shape());
@@ -468,7 +473,7 @@ void GeomAlgoAPI_Prism::buildByPlanes(const GeomShapePtr             theBaseShap
   TopoDS_Shape aToSolid = aToPrismBuilder->Shape();
 
   // Cutting with to plane.
-  BRepAlgoAPI_Cut* aToCutBuilder = new BRepAlgoAPI_Cut(aResult, aToSolid);
+  BRepAlgoAPI_Cut* aToCutBuilder = makeCut(aResult, aToSolid);
   aToCutBuilder->Build();
   if(!aToCutBuilder->IsDone()) {
     return;
@@ -505,7 +510,7 @@ void GeomAlgoAPI_Prism::buildByPlanes(const GeomShapePtr             theBaseShap
   TopoDS_Shape aFromSolid = aFromPrismBuilder->Shape();
 
   // Cutting with from plane.
-  BRepAlgoAPI_Cut* aFromCutBuilder = new BRepAlgoAPI_Cut(aResult, aFromSolid);
+  BRepAlgoAPI_Cut* aFromCutBuilder = makeCut(aResult, aFromSolid);
   aFromCutBuilder->Build();
   if(!aFromCutBuilder->IsDone()) {
     return;
@@ -895,3 +900,16 @@ void storeGenerationHistory(GeomAlgoAPI_Prism* thePrismAlgo,
     }
   }
 }
+
+//==================================================================================================
+BRepAlgoAPI_Cut* makeCut(const TopoDS_Shape& theObject, const TopoDS_Shape& theTool)
+{
+  TopTools_ListOfShape anObjects, aTools;
+  anObjects.Append(theObject);
+  aTools.Append(theTool);
+  BRepAlgoAPI_Cut* aCutBuilder = new BRepAlgoAPI_Cut;
+  aCutBuilder->SetArguments(anObjects);
+  aCutBuilder->SetTools(aTools);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aCutBuilder);
+  return aCutBuilder;
+}
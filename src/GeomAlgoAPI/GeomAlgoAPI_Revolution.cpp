@@ -26,6 +26,7 @@
 #include <GeomAlgoAPI_FaceBuilder.h>
 #include <GeomAlgoAPI_MakeShapeList.h>
 #include <GeomAlgoAPI_ShapeTools.h>
+#include <GeomAlgoAPI_Tools.h>
 
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
@@ -91,6 +92,10 @@ static void storeGenerationHistory(GeomAlgoAPI_Revolution* theRevolutionAlgo,
                                    const TopoDS_Shape& theModifiedBaseShape,
                                    const bool theIsFromFaceSet);
 
+/// Creates the cut of theTool from theObject with the options of the boolean operations.
+/// The operation is not built.
+static BRepAlgoAPI_Cut* makeCut(const TopoDS_Shape& theObject, const TopoDS_Shape& theTool);
+
 //==================================================================================================
 GeomAlgoAPI_Revolution::GeomAlgoAPI_Revolution(const GeomShapePtr                 theBaseShape,
                                                const std::shared_ptr<GeomAPI_Ax1> theAxis,
@@ -275,7 +280,7 @@ void GeomAlgoAPI_Revolution::build(const GeomShapePtr&                 theBaseSh
     aToSolid = aToTransform.Shape();
 
     // Cutting revolution with from plane.
-    BRepAlgoAPI_Cut* aFromCutBuilder = new BRepAlgoAPI_Cut(aResult, aFromSolid);
+    BRepAlgoAPI_Cut* aFromCutBuilder = makeCut(aResult, aFromSolid);
     aFromCutBuilder->Build();
     if(!aFromCutBuilder->IsDone()) {
       return;
@@ -288,7 +293,7 @@ void GeomAlgoAPI_Revolution::build(const GeomShapePtr&                 theBaseSh
     }
 
     // Cutting revolution with to plane.
-    BRepAlgoAPI_Cut* aToCutBuilder = new BRepAlgoAPI_Cut(aResult, aToSolid);
+    BRepAlgoAPI_Cut* aToCutBuilder = makeCut(aResult, aToSolid);
     aToCutBuilder->Build();
     if(!aToCutBuilder->IsDone()) {
       return;
@@ -382,7 +387,7 @@ void GeomAlgoAPI_Revolution::build(const GeomShapePtr&                 theBaseSh
     aBoundingSolid = aBoundingTransform.Shape();
 
     // Cutting revolution with bounding plane.
-    BRepAlgoAPI_Cut* aBoundingCutBuilder = new BRepAlgoAPI_Cut(aResult, aBoundingSolid);
+    BRepAlgoAPI_Cut* aBoundingCutBuilder = makeCut(aResult, aBoundingSolid);
     aBoundingCutBuilder->Build();
     if(!aBoundingCutBuilder->IsDone()) {
       return;
@@ -448,7 +453,7 @@ void GeomAlgoAPI_Revolution::build(const GeomShapePtr&                 theBaseSh
     aBaseSolid = aBaseTransform.Shape();
 
     // Cutting revolution with base.
-    BRepAlgoAPI_Cut* aBaseCutBuilder = new BRepAlgoAPI_Cut(aResult, aBaseSolid);
+    BRepAlgoAPI_Cut* aBaseCutBuilder = makeCut(aResult, aBaseSolid);
     aBaseCutBuilder->Build();
     if(aBaseCutBuilder->IsDone()) {
       TopoDS_Shape aCutResult = aBaseCutBuilder->Shape();
@@ -736,3 +741,16 @@ void storeGenerationHistory(GeomAlgoAPI_Revolution* theRevolutionAlgo,
     }
   }
 }
+
+//==================================================================================================
+BRepAlgoAPI_Cut* makeCut(const TopoDS_Shape& theObject, const TopoDS_Shape& theTool)
+{
+  TopTools_ListOfShape anObjects, aTools;
+  anObjects.Append(theObject);
+  aTools.Append(theTool);
+  BRepAlgoAPI_Cut* aCutBuilder = new BRepAlgoAPI_Cut;
+  aCutBuilder->SetArguments(anObjects);
+  aCutBuilder->SetTools(aTools);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aCutBuilder);
+  return aCutBuilder;
+}
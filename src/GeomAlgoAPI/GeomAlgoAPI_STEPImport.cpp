@@ -222,24 +222,30 @@ GeomShapePtr STEPImportAttributs(const std::string& theFileName,
 {
 
   try {
-    STEPControl_Reader aReader;
     std::shared_ptr<GeomAPI_Shape> aGeomShape(new GeomAPI_Shape);
 
     Interface_Static::SetCVal("xstep.cascade.unit", "M");
     Interface_Static::SetIVal("read.step.ideas", 1);
     Interface_Static::SetIVal("read.step.nonmanifold", 1);
 
+    STEPCAFControl_Reader aCafreader;
+    aCafreader.SetColorMode(true);
+    aCafreader.SetNameMode(true);
+    aCafreader.SetMatMode(true);
+
+    // the file is parsed once: the units are taken from the model read by the XCAF reader
     try {
       OCC_CATCH_SIGNALS;
 
-      IFSelect_ReturnStatus status = aReader.ReadFile(theFileName.c_str());
-
-      if (status == IFSelect_RetDone) {
-        // Regard or not the model units
-        if( !readUnits(aReader, theScalInterUnits, theError)) {
-          aGeomShape->setImpl(new TopoDS_Shape());
-          return aGeomShape;
-        }
+      if (aCafreader.ReadFile(theFileName.c_str()) != IFSelect_RetDone) {
+        theError = "Wrong format of the imported file. Can't import file.";
+        aGeomShape->setImpl(new TopoDS_Shape());
+        return aGeomShape;
+      }
+      // Regard or not the model units
+      if( !readUnits(aCafreader.ChangeReader(), theScalInterUnits, theError)) {
+        aGeomShape->setImpl(new TopoDS_Shape());
+        return aGeomShape;
       }
     } catch (Standard_Failure const& anException) {
       theError = anException.GetMessageString();
@@ -247,17 +253,6 @@ GeomShapePtr STEPImportAttributs(const std::string& theFileName,
       return aGeomShape;
     }
 
-    STEPCAFControl_Reader aCafreader;
-    aCafreader.SetColorMode(true);
-    aCafreader.SetNameMode(true);
-    aCafreader.SetMatMode(true);
-
-    if (aCafreader.ReadFile(theFileName.c_str()) != IFSelect_RetDone) {
-      theError = "Wrong format of the imported file. Can't import file.";
-      aGeomShape->setImpl(new TopoDS_Shape());
-      return aGeomShape;
-    }
-
     return readAttributes(aCafreader,
                           theResultBody,
                           theMaterials,
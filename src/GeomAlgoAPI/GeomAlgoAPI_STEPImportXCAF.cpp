@@ -25,6 +25,9 @@
 #include <Interface_Graph.hxx>
 #include <Interface_InterfaceModel.hxx>
 
+#include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
+
 #include <Quantity_Color.hxx>
 
 #include <StepRepr_DescriptiveRepresentationItem.hxx>
@@ -40,7 +43,9 @@
 #include <TopoDS.hxx>
 #include <Transfer_TransientProcess.hxx>
 #include <TransferBRep.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
 #include <XCAFApp_Application.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
@@ -53,6 +58,11 @@
 
 #include <Locale_Convert.h>
 
+#include <vector>
+
+/// names of materials found for an entity of the file, with the sub-shapes they are set to
+typedef std::vector<std::pair<std::wstring, TopoDS_Shape> > EntityMaterials;
+
 // read geometry
 std::shared_ptr<GeomAPI_Shape> setGeom(const Handle(XCAFDoc_ShapeTool) &shapeTool,
   const TDF_Label &theLabel,
@@ -68,13 +78,36 @@ void setShapeAttributes(const Handle(XCAFDoc_ShapeTool) &theShapeTool,
   std::map< std::wstring, std::list<std::wstring>> &theMaterialShape,
   bool theIsRef);
 
-// store Materiel for theShapeLabel in the map theMaterialShape
-void storeMaterial(std::shared_ptr<ModelAPI_ResultBody> theResultBody,
-  const Handle(Standard_Transient) &theEnti,
-  const TopTools_IndexedMapOfShape &theIndices,
+// collect materials of theEnti set to the sub-shapes of the imported shape;
+// thePartners contains the sub-shapes sharing the same TShape, the key has no location
+void collectMaterials(const Handle(Standard_Transient) &theEnti,
   const Handle(Transfer_TransientProcess) &theTP,
-  const TDF_Label &theShapeLabel,
-  std::map< std::wstring, std::list<std::wstring>> &theMaterialShape);
+  const TopTools_IndexedDataMapOfShapeListOfShape &thePartners,
+  EntityMaterials &theMaterials);
+
+namespace {
+  /// Functor for the parallel search of materials in the entities of the file
+  class MaterialsFunctor
+  {
+  public:
+    MaterialsFunctor(const Handle(Interface_InterfaceModel)& theModel,
+                     const Handle(Transfer_TransientProcess)& theTP,
+                     const TopTools_IndexedDataMapOfShapeListOfShape& thePartners,
+                     std::vector<EntityMaterials>& theMaterials)
+      : myModel(theModel), myTP(theTP), myPartners(thePartners), myMaterials(theMaterials) {}
+
+    void operator()(const int theIndex) const
+    {
+      collectMaterials(myModel->Value(theIndex + 1), myTP, myPartners, myMaterials[theIndex]);
+    }
+
+  private:
+    const Handle(Interface_InterfaceModel)& myModel;
+    const Handle(Transfer_TransientProcess)& myTP;
+    const TopTools_IndexedDataMapOfShapeListOfShape& myPartners;
+    std::vector<EntityMaterials>& myMaterials;
+  };
+}
 
 //=============================================================================
 TopoDS_Shape getShape(const Handle(Standard_Transient) &theEnti,
@@ -118,25 +151,53 @@ std::shared_ptr<GeomAPI_Shape> readAttributes(STEPCAFControl_Reader &theReader,
 
   std::shared_ptr<GeomAPI_Shape> ageom =  setGeom(shapeTool,mainLabel,theError);
 
-  STEPControl_Reader aReader = theReader.ChangeReader();
+  STEPControl_Reader& aReader = theReader.ChangeReader();
 
   // BEGIN: reading materials of sub-shapes from file
   if (theIsMaterials) {
     TopTools_IndexedMapOfShape anIndices;
     TopExp::MapShapes(ageom->impl<TopoDS_Shape>(), anIndices);
+    // group the sub-shapes by TShape, as a product may be included several times
+    TopTools_IndexedDataMapOfShapeListOfShape aPartners;
+    for (Standard_Integer anISub = 1; anISub <= anIndices.Extent(); anISub++) {
+      const TopoDS_Shape& aSub = anIndices.FindKey(anISub);
+      TopoDS_Shape aKey = aSub.Located(TopLoc_Location());
+      if (!aPartners.Contains(aKey))
+        aPartners.Add(aKey, TopTools_ListOfShape());
+      aPartners.ChangeFromKey(aKey).Append(aSub);
+    }
 
     Handle(Interface_InterfaceModel) Model = aReader.WS()->Model();
     Handle(XSControl_TransferReader) TR = aReader.WS()->TransferReader();
     if (!TR.IsNull()) {
       Handle(Transfer_TransientProcess) TP = TR->TransientProcess();
 
-      Standard_Integer nb = Model->NbEntities();
-
-      for (Standard_Integer ie = 1; ie <= nb; ie++) {
-        Handle(Standard_Transient) enti = Model->Value(ie);
+      // entities are independent: search their materials in parallel, store them in order
+      std::vector<EntityMaterials> aMaterials(Model->NbEntities());
+      OSD_Parallel::For(0, (int)aMaterials.size(),
+                        MaterialsFunctor(Model, TP, aPartners, aMaterials));
+
+      // first name of the sub-shape, as ModelAPI_ResultBody::findShapeName returns
+      std::map<std::wstring, std::shared_ptr<GeomAPI_Shape> > aNamesOfShapes;
+      std::map<std::wstring, std::vector<int> > aColorsOfShapes;
+      theResultBody->getShapeName(aNamesOfShapes, aColorsOfShapes);
+      NCollection_DataMap<TopoDS_Shape, std::wstring, TopTools_ShapeMapHasher> aShapeNames;
+      std::map<std::wstring, std::shared_ptr<GeomAPI_Shape> >::iterator aNameIt =
+        aNamesOfShapes.begin();
+      for (; aNameIt != aNamesOfShapes.end(); ++aNameIt) {
+        const TopoDS_Shape& aShape = aNameIt->second->impl<TopoDS_Shape>();
+        if (!aShapeNames.IsBound(aShape))
+          aShapeNames.Bind(aShape, aNameIt->first);
+      }
 
-        // Store materials.
-        storeMaterial(theResultBody,enti, anIndices, TP, mainLabel,theMaterialShape);
+      std::vector<EntityMaterials>::iterator anEntIt = aMaterials.begin();
+      for (; anEntIt != aMaterials.end(); ++anEntIt) {
+        EntityMaterials::iterator aMatIt = anEntIt->begin();
+        for (; aMatIt != anEntIt->end(); ++aMatIt) {
+          std::wstring aNom = aShapeNames.IsBound(aMatIt->second) ?
+            aShapeNames.Find(aMatIt->second) : std::wstring(L"material not found");
+          theMaterialShape[aMatIt->first].push_back(aNom);
+        }
       }
     }
   }
@@ -358,12 +419,10 @@ void setShapeAttributes(const Handle(XCAFDoc_ShapeTool) &theShapeTool,
 }
 
 //=============================================================================
-void storeMaterial( std::shared_ptr<ModelAPI_ResultBody>    theResultBody,
-                    const Handle(Standard_Transient)        &theEnti,
-                    const TopTools_IndexedMapOfShape        &theIndices,
-                    const Handle(Transfer_TransientProcess) &theTP,
-                    const TDF_Label                         &/*theShapeLabel*/,
-                    std::map< std::wstring, std::list<std::wstring>> &theMaterialShape )
+void collectMaterials(const Handle(Standard_Transient)                &theEnti,
+                      const Handle(Transfer_TransientProcess)         &theTP,
+                      const TopTools_IndexedDataMapOfShapeListOfShape &thePartners,
+                      EntityMaterials                                 &theMaterials)
 {
   // Treat Product Definition Shape only.
   Handle(StepRepr_ProductDefinitionShape) aPDS =
@@ -423,19 +482,12 @@ void storeMaterial( std::shared_ptr<ModelAPI_ResultBody>    theResultBody,
 
                     // as PRODUCT can be included in the main shape
                     // several times, we look here for all iclusions.
-                    Standard_Integer anISub, aNbSubs = theIndices.Extent();
-
-                    for (anISub = 1; anISub <= aNbSubs; anISub++) {
-                      TopoDS_Shape aSub = theIndices.FindKey(anISub);
-
-                      if (aSub.IsPartner(aShape)) {
-                        std::shared_ptr<GeomAPI_Shape> aShapeGeom(new GeomAPI_Shape);
-                        aShapeGeom->setImpl(new TopoDS_Shape(aSub));
-                        std::wstring aNom = theResultBody->findShapeName(aShapeGeom);
-                        std::wstring aMName= Locale::Convert::toWString(aMatName->ToCString());
-                        theMaterialShape[aMName].push_back(aNom);
-
-                      }
+                    TopoDS_Shape aKey = aShape.Located(TopLoc_Location());
+                    if (thePartners.Contains(aKey)) {
+                      std::wstring aMName= Locale::Convert::toWString(aMatName->ToCString());
+                      TopTools_ListIteratorOfListOfShape aSubIt(thePartners.FindFromKey(aKey));
+                      for (; aSubIt.More(); aSubIt.Next())
+                        theMaterials.push_back(std::make_pair(aMName, aSubIt.Value()));
                     }
                   }
                 }
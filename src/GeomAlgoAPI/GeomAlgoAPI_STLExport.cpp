@@ -24,18 +24,8 @@
 #include <TopoDS_Shape.hxx>
 
 // OOCT includes
-#include <BRepBuilderAPI_Copy.hxx>
 #include <StlAPI_Writer.hxx>
 #include <TopoDS_Shape.hxx>
-#include <Bnd_Box.hxx>
-#include <BRepBndLib.hxx>
-#include <BRepTools.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
-
-
-
-#define MAX2(X, Y)      ( Abs(X) > Abs(Y) ? Abs(X) : Abs(Y) )
-#define MAX3(X, Y, Z)   ( MAX2 ( MAX2(X, Y) , Z ) )
 
 bool STLExport(const std::string& theFileName,
                const std::shared_ptr<GeomAPI_Shape>& theShape,
@@ -56,25 +46,14 @@ bool STLExport(const std::string& theFileName,
   try
   {
 
-    double aDeflection = theDeflection;
     StlAPI_Writer aWriter;
-    // copy source shape
-    BRepBuilderAPI_Copy aCopy( theShape->impl<TopoDS_Shape>(), Standard_False );
-    TopoDS_Shape aCopyShape = aCopy.Shape();
     // ASCII mode
     aWriter.ASCIIMode() = theIsASCII;
-    if ( theIsRelative ) {
-      Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
-      Bnd_Box aBndBox;
-      BRepBndLib::Add( theShape->impl<TopoDS_Shape>(), aBndBox );
-      aBndBox.Get( aXmin, aYmin, aZmin, aXmax, aYmax, aZmax );
-      aDeflection = MAX3( aXmax-aXmin, aYmax-aYmin, aZmax-aZmin ) * theDeflection;
-    }
-    //Compute triangulation
-    BRepTools::Clean( aCopyShape );
-    BRepMesh_IncrementalMesh aMesh( aCopyShape, aDeflection );
+    // triangulation of the source shape, or of its copy, if the source is not meshed enough
+    std::shared_ptr<GeomAPI_Shape> aMeshed =
+      GeomAlgoAPI_Tools::Mesh_Tools::meshed(theShape, theDeflection, theIsRelative);
 
-    if (!aWriter.Write( aCopyShape, theFileName.c_str())) {
+    if (!aWriter.Write( aMeshed->impl<TopoDS_Shape>(), theFileName.c_str())) {
       theError = "STL Export failed";
       return false;
     }
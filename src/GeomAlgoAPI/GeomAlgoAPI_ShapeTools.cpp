@@ -20,6 +20,7 @@
 #include "GeomAlgoAPI_ShapeTools.h"
 
 #include "GeomAlgoAPI_SketchBuilder.h"
+#include "GeomAlgoAPI_Tools.h"
 
 #include <Basics_OCCTVersion.hxx>
 
@@ -52,7 +53,6 @@
 #include <BRepExtrema_ExtCF.hxx>
 #include <BRepExtrema_ShapeProximity.hxx>
 #include <BRepGProp.hxx>
-#include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
 #include <BRepTools_WireExplorer.hxx>
 #include <BRepTopAdaptor_FClass2d.hxx>
@@ -349,25 +349,6 @@ auto getExtemaDistShape = [](const GeomShapePtr& theShape1,
   return aDist;
 };
 
-static void tessellateShape(const TopoDS_Shape& theShape)
-{
-  Standard_Boolean isTessellate = Standard_False;
-  TopLoc_Location aLoc;
-  for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More() && !isTessellate; anExp.Next()) {
-    Handle(Poly_Triangulation) aTria = BRep_Tool::Triangulation(TopoDS::Face(anExp.Value()), aLoc);
-    isTessellate = aTria.IsNull();
-  }
-  for (TopExp_Explorer anExp(theShape, TopAbs_EDGE); anExp.More() && !isTessellate; anExp.Next()) {
-    Handle(Poly_Polygon3D) aPoly = BRep_Tool::Polygon3D(TopoDS::Edge(anExp.Value()), aLoc);
-    isTessellate = aPoly.IsNull();
-  }
-
-  if (isTessellate) {
-    BRepMesh_IncrementalMesh aMesher(theShape, 0.1);
-    Standard_ProgramError_Raise_if(!aMesher.IsDone(), "Meshing failed");
-  }
-}
-
 static Standard_Real paramOnCurve(const BRepAdaptor_Curve& theCurve,
                                   const gp_Pnt&            thePoint,
                                   const Standard_Real      theTol)
@@ -562,8 +543,8 @@ double GeomAlgoAPI_ShapeTools::shapeProximity(const GeomShapePtr& theShape1,
   TopAbs_ShapeEnum aType2 = aShape2.ShapeType();
 
   // tessellate shapes if there is no mesh exists
-  tessellateShape(aShape1);
-  tessellateShape(aShape2);
+  GeomAlgoAPI_Tools::Mesh_Tools::meshIfNone(theShape1);
+  GeomAlgoAPI_Tools::Mesh_Tools::meshIfNone(theShape2);
 
   BRepExtrema_ShapeProximity aDist (aShape1, aShape2);
   aDist.Perform();
@@ -1428,6 +1409,7 @@ void GeomAlgoAPI_ShapeTools::splitShape(const std::shared_ptr<GeomAPI_Shape>& th
     aBOP.AddArgument(aV);
   }
 
+  GeomAlgoAPI_Tools::BOP_Policy::apply(aBOP);
   aBOP.Perform();
   if (aBOP.HasErrors())
     return;
@@ -1473,6 +1455,7 @@ void GeomAlgoAPI_ShapeTools::splitShape_p(const std::shared_ptr<GeomAPI_Shape>&
     aBOP.AddArgument(aV);
   }
 
+  GeomAlgoAPI_Tools::BOP_Policy::apply(aBOP);
   aBOP.Perform();
   if (aBOP.HasErrors())
     return;
@@ -18,6 +18,7 @@
 //
 
 #include <GeomAlgoAPI_SketchBuilder.h>
+#include <GeomAlgoAPI_Tools.h>
 #include <GeomAPI_PlanarEdges.h>
 
 #include <GeomAPI_Pln.h>
@@ -38,6 +39,7 @@
 #include <BRepGProp.hxx>
 
 #include <list>
+#include <vector>
 #include <cmath>
 #include <algorithm>
 
@@ -65,139 +67,150 @@ static TopoDS_Vertex findStartVertex(const TopoDS_Shape& theShape)
   return aStart;
 }
 
-static TopoDS_Vertex findStartVertex(const TopoDS_Wire& theWire, const TopoDS_Face& theFace,
-    const std::list<std::shared_ptr<GeomAPI_Shape> >& theInitialShapes)
+// returns the basis curve of the edge
+static Handle(Geom_Curve) basisCurve(const TopoDS_Edge& theEdge, double& theFirst, double& theLast)
+{
+  Handle(Geom_Curve) aCurve = BRep_Tool::Curve(theEdge, theFirst, theLast);
+  if (aCurve->DynamicType() == STANDARD_TYPE(Geom_TrimmedCurve))
+    aCurve = Handle(Geom_TrimmedCurve)::DownCast(aCurve)->BasisCurve();
+  return aCurve;
+}
+
+// collects indices of curves of the initial edges (in the order of edges) and the first
+// parameter of the edge where each curve is met first
+static void indexCurves(const std::list<std::shared_ptr<GeomAPI_Shape> >& theInitialShapes,
+  NCollection_DataMap<Handle(Geom_Curve), int>& theCurveToIndex,
+  NCollection_DataMap<Handle(Geom_Curve), double>& theCurveToFirst)
 {
-  // Try to find edge lying on the one of original edges.
-  // First found edge will be taken as a start edge for the result wire
   std::list<std::shared_ptr<GeomAPI_Shape> >::const_iterator aFeatIt = theInitialShapes.begin();
-  for (; aFeatIt != theInitialShapes.end(); aFeatIt++) {
+  for (int anIndex = 0; aFeatIt != theInitialShapes.end(); aFeatIt++) {
     std::shared_ptr<GeomAPI_Shape> aShape(*aFeatIt);
     const TopoDS_Edge& anEdge = aShape->impl<TopoDS_Edge>();
     if (anEdge.ShapeType() != TopAbs_EDGE)
       continue;
 
     double aFirst, aLast;
-    Handle(Geom_Curve) aCurve = BRep_Tool::Curve(anEdge, aFirst, aLast);
-    if (aCurve->DynamicType() == STANDARD_TYPE(Geom_TrimmedCurve))
-      aCurve = Handle(Geom_TrimmedCurve)::DownCast(aCurve)->BasisCurve();
-
-    BRepTools_WireExplorer anExp(theWire, theFace);
-    for (; anExp.More(); anExp.Next()) {
-      const TopoDS_Edge& aShapeEdge = anExp.Current();
-      double aF, aL;
-      Handle(Geom_Curve) aShapeCurve = BRep_Tool::Curve(aShapeEdge, aF, aL);
-      if (aShapeCurve->DynamicType() == STANDARD_TYPE(Geom_TrimmedCurve))
-        aShapeCurve = Handle(Geom_TrimmedCurve)::DownCast(aShapeCurve)->BasisCurve();
-
-      if (aCurve != aShapeCurve)
-        continue;
-
-      // the edge is found, search vertex
-      TopoDS_Vertex aV1, aV2;
-      TopExp::Vertices(aShapeEdge, aV1, aV2);
-      return fabs(aF - aFirst) <= fabs(aL - aFirst) ? aV1 : aV2;
+    Handle(Geom_Curve) aCurve = basisCurve(anEdge, aFirst, aLast);
+    if (!theCurveToIndex.IsBound(aCurve)) {
+      theCurveToIndex.Bind(aCurve, anIndex++);
+      theCurveToFirst.Bind(aCurve, aFirst);
+    }
+  }
+}
+
+static TopoDS_Vertex findStartVertex(const TopoDS_Wire& theWire, const TopoDS_Face& theFace,
+    const NCollection_DataMap<Handle(Geom_Curve), int>& theCurveToIndex,
+    const NCollection_DataMap<Handle(Geom_Curve), double>& theCurveToFirst)
+{
+  // Try to find edge lying on the one of original edges.
+  // Edge on the original edge with the lowest index will be taken as a start edge for the wire
+  int aStartIndex = -1;
+  TopoDS_Edge aStartEdge;
+  Handle(Geom_Curve) aStartCurve;
+  double aStartF = 0., aStartL = 0.;
+  BRepTools_WireExplorer anExp(theWire, theFace);
+  for (; anExp.More(); anExp.Next()) {
+    double aF, aL;
+    Handle(Geom_Curve) aShapeCurve = basisCurve(anExp.Current(), aF, aL);
+    const int* anIndex = theCurveToIndex.Seek(aShapeCurve);
+    if (anIndex && (aStartIndex < 0 || *anIndex < aStartIndex)) {
+      aStartIndex = *anIndex;
+      aStartEdge = anExp.Current();
+      aStartCurve = aShapeCurve;
+      aStartF = aF;
+      aStartL = aL;
     }
   }
+  if (aStartIndex >= 0) { // the edge is found, search vertex
+    double aFirst = theCurveToFirst.Find(aStartCurve);
+    TopoDS_Vertex aV1, aV2;
+    TopExp::Vertices(aStartEdge, aV1, aV2);
+    return fabs(aStartF - aFirst) <= fabs(aStartL - aFirst) ? aV1 : aV2;
+  }
 
   // start vertex is not found, use algorithm to search vertex with the greatest coordinates
   return findStartVertex(theWire);
 }
 
-// returns true if the first shape must be located earlier than the second
-bool isFirst(const TopoDS_Shape& theFirst, const TopoDS_Shape& theSecond,
-  NCollection_DataMap<TopoDS_Shape, NCollection_Array1<int> >& theAreaToIndex,
-  const NCollection_DataMap<Handle(Geom_Curve), int>& theCurveToIndex)
+// key of an area to sort, computed once per area
+struct AreaKey {
+  TopoDS_Shape myArea;
+  std::vector<int> myIndices; ///< sorted indices of the initial curves of the area edges
+  bool myHasCentre;
+  double myCentre; ///< sum of coordinates of the centre of mass, computed on demand
+};
+
+// returns the sum of coordinates of the area centre of mass, computed once for each area
+static double areaCentre(AreaKey& theKey)
 {
-  // fill theAreaToIndex for both shapes if needed
-  for(int aShapeNum = 1; aShapeNum <= 2; aShapeNum++) {
-    TopoDS_Shape aShape = aShapeNum == 1 ? theFirst : theSecond;
-    if (!theAreaToIndex.IsBound(aShape)) { // fill the list of curve indices
-      NCollection_List<int> aNewList;
-      TopExp_Explorer anEdgesExp(aShape, TopAbs_EDGE);
-      for (; anEdgesExp.More(); anEdgesExp.Next()) {
-        double aFirst, aLast;
-        Handle(Geom_Curve) aCurve = BRep_Tool::Curve(
-          TopoDS::Edge(anEdgesExp.Current()), aFirst, aLast);
-        if (aCurve->DynamicType() == STANDARD_TYPE(Geom_TrimmedCurve))
-          aCurve = Handle(Geom_TrimmedCurve)::DownCast(aCurve)->BasisCurve();
-        if (theCurveToIndex.IsBound(aCurve)) {
-          aNewList.Append(theCurveToIndex.Find(aCurve));
-        }
-      }
-      if (aNewList.Extent()) {
-        NCollection_Array1<int> aNewArray(1, aNewList.Extent());
-        NCollection_List<int>::Iterator aListIter(aNewList);
-        for (int anIndex = 1; aListIter.More(); aListIter.Next(), anIndex++) {
-          aNewArray.SetValue(anIndex, aListIter.Value());
-        }
-        std::sort(aNewArray.begin(), aNewArray.end());
-        theAreaToIndex.Bind(aShape, aNewArray);
-      }
-    }
+  if (!theKey.myHasCentre) {
+    GProp_GProps aGProps;
+    BRepGProp::SurfaceProperties(theKey.myArea, aGProps);
+    gp_Pnt aCentre = aGProps.CentreOfMass();
+    theKey.myCentre = aCentre.X() + aCentre.Y() + aCentre.Z();
+    theKey.myHasCentre = true;
   }
-  bool isFirst;
-  bool aGeomCompare = !theAreaToIndex.IsBound(theFirst) || !theAreaToIndex.IsBound(theSecond);
-  if (!aGeomCompare) {
-    // compare lists of indices one by one to find chich list indices are lower
-    NCollection_Array1<int>::Iterator aFirstList(theAreaToIndex.ChangeFind(theFirst));
-    NCollection_Array1<int>::Iterator aSecondList(theAreaToIndex.ChangeFind(theSecond));
-    for (; aFirstList.More() && aSecondList.More(); aFirstList.Next(), aSecondList.Next()) {
-      if (aFirstList.Value() < aSecondList.Value()) return true;
-      if (aFirstList.Value() > aSecondList.Value()) return false;
+  return theKey.myCentre;
+}
+
+// returns true if the first area must be located earlier than the second
+static bool isFirst(AreaKey* theFirst, AreaKey* theSecond)
+{
+  // areas without initial curves are compared by geometry only
+  if (!theFirst->myIndices.empty() && !theSecond->myIndices.empty()) {
+    // compare lists of indices one by one to find which list indices are lower
+    std::vector<int>::const_iterator aFirstList = theFirst->myIndices.begin();
+    std::vector<int>::const_iterator aSecondList = theSecond->myIndices.begin();
+    for (; aFirstList != theFirst->myIndices.end() && aSecondList != theSecond->myIndices.end();
+         ++aFirstList, ++aSecondList) {
+      if (*aFirstList < *aSecondList) return true;
+      if (*aFirstList > *aSecondList) return false;
     }
-    aGeomCompare = !aFirstList.More() && !aSecondList.More();
-    isFirst = !aFirstList.More();
-  } else {
-    isFirst = !theAreaToIndex.IsBound(theFirst);
+    bool isFirstEnd = aFirstList == theFirst->myIndices.end();
+    // if in first list there is no elements left, it is the first
+    if (isFirstEnd != (aSecondList == theSecond->myIndices.end()))
+      return isFirstEnd;
   }
   // if faces are identical by curves names (circle split by line in seam-point), use parameters
-  if (aGeomCompare) {
-    GProp_GProps aGProps;
-    BRepGProp::SurfaceProperties(theFirst, aGProps);
-    gp_Pnt aCentre1 = aGProps.CentreOfMass();
-    BRepGProp::SurfaceProperties(theSecond, aGProps);
-    gp_Pnt aCentre2 = aGProps.CentreOfMass();
-    return aCentre1.X() + aCentre1.Y() + aCentre1.Z() < aCentre2.X() + aCentre2.Y() + aCentre2.Z();
-  }
-  // if in first list there is no elements left, it is the first
-  return isFirst;
+  return areaCentre(*theFirst) < areaCentre(*theSecond);
 }
 
 // sorts faces (in theAreas list) to make persistent order: by initial shapes edges
+// (theCurveToIndex contains indices of curves of all initial edges to operate them quickly)
 static void sortAreas(TopTools_ListOfShape& theAreas,
-  const std::list<std::shared_ptr<GeomAPI_Shape> >& theInitialShapes)
+  const NCollection_DataMap<Handle(Geom_Curve), int>& theCurveToIndex)
 {
-  // collect indices of all edges to operate them quickly
-  NCollection_DataMap<Handle(Geom_Curve), int> aCurveToIndex; // curve -> index in initial shapes
-  std::list<std::shared_ptr<GeomAPI_Shape> >::const_iterator aFeatIt = theInitialShapes.begin();
-  for (int anIndex = 0; aFeatIt != theInitialShapes.end(); aFeatIt++) {
-    std::shared_ptr<GeomAPI_Shape> aShape(*aFeatIt);
-    const TopoDS_Edge& anEdge = aShape->impl<TopoDS_Edge>();
-    if (anEdge.ShapeType() != TopAbs_EDGE)
-      continue;
-
-    double aFirst, aLast;
-    Handle(Geom_Curve) aCurve = BRep_Tool::Curve(anEdge, aFirst, aLast);
-    if (aCurve->DynamicType() == STANDARD_TYPE(Geom_TrimmedCurve))
-      aCurve = Handle(Geom_TrimmedCurve)::DownCast(aCurve)->BasisCurve();
-    if (!aCurveToIndex.IsBound(aCurve))
-      aCurveToIndex.Bind(aCurve, anIndex++);
+  // the keys are computed once; isFirst is not a strict weak ordering (areas without initial
+  // curves are compared by geometry with any area), so, the areas are exchanged pairwise
+  std::vector<AreaKey> aKeys(theAreas.Extent());
+  std::vector<AreaKey*> anOrder;
+  anOrder.reserve(aKeys.size());
+  TopTools_ListOfShape::Iterator anArea(theAreas);
+  for (std::vector<AreaKey>::iterator aKey = aKeys.begin(); anArea.More(); anArea.Next(), ++aKey) {
+    aKey->myArea = anArea.Value();
+    aKey->myHasCentre = false;
+    aKey->myCentre = 0.;
+    for (TopExp_Explorer anEdgesExp(anArea.Value(), TopAbs_EDGE); anEdgesExp.More();
+         anEdgesExp.Next()) {
+      double aFirst, aLast;
+      Handle(Geom_Curve) aCurve = basisCurve(TopoDS::Edge(anEdgesExp.Current()), aFirst, aLast);
+      const int* anIndex = theCurveToIndex.Seek(aCurve);
+      if (anIndex)
+        aKey->myIndices.push_back(*anIndex);
+    }
+    std::sort(aKey->myIndices.begin(), aKey->myIndices.end());
+    anOrder.push_back(&(*aKey));
   }
-  // map from area to the most first indices of curves (to compare) in it
-  NCollection_DataMap<TopoDS_Shape, NCollection_Array1<int> > anAreaToIndex;
-  // sort areas
-  TopTools_ListOfShape::Iterator anArea1(theAreas);
-  for(; anArea1.More(); anArea1.Next()) {
-    TopTools_ListOfShape::Iterator anArea2 = anArea1;
-    for(anArea2.Next(); anArea2.More(); anArea2.Next()) {
-      if (!isFirst(anArea1.Value(), anArea2.Value(), anAreaToIndex, aCurveToIndex)) { // exchange
-        TopoDS_Shape aTmp = anArea1.Value();
-        anArea1.ChangeValue() = anArea2.Value();
-        anArea2.ChangeValue() = aTmp;
-      }
+  for (size_t anArea1 = 0; anArea1 < anOrder.size(); ++anArea1) {
+    for (size_t anArea2 = anArea1 + 1; anArea2 < anOrder.size(); ++anArea2) {
+      if (!isFirst(anOrder[anArea1], anOrder[anArea2])) // exchange
+        std::swap(anOrder[anArea1], anOrder[anArea2]);
     }
   }
+
+  theAreas.Clear();
+  for (std::vector<AreaKey*>::iterator aKey = anOrder.begin(); aKey != anOrder.end(); ++aKey)
+    theAreas.Append((*aKey)->myArea);
 }
 
 void GeomAlgoAPI_SketchBuilder::build(
@@ -224,7 +237,7 @@ void GeomAlgoAPI_SketchBuilder::build(
   // Set fuzzy value for BOP, because PlaneGCS can solve the set of constraints with
   // the precision up to 5.e-5 if the sketch contains arcs.
   static const double THE_FUZZY_TOL = 5.e-5;
-  aBB->SetFuzzyValue(THE_FUZZY_TOL);
+  GeomAlgoAPI_Tools::BOP_Policy::apply(*aBB, THE_FUZZY_TOL);
 
   setImpl(aBB);
   setBuilderType(OCCT_BOPAlgo_Builder);
@@ -245,9 +258,14 @@ void GeomAlgoAPI_SketchBuilder::build(
   TopoDS_Compound aResult;
   aBuilder.MakeCompound(aResult);
 
+  // curve -> index in initial shapes, computed once for sorting of all faces and wires
+  NCollection_DataMap<Handle(Geom_Curve), int> aCurveToIndex;
+  NCollection_DataMap<Handle(Geom_Curve), double> aCurveToFirst;
+  indexCurves(theEdges, aCurveToIndex, aCurveToFirst);
+
   // Collect faces
   TopTools_ListOfShape anAreas = aBB->Modified(aPlnFace);
-  sortAreas(anAreas, theEdges); // sort faces by the edges in them
+  sortAreas(anAreas, aCurveToIndex); // sort faces by the edges in them
   TopTools_ListIteratorOfListOfShape anIt(anAreas);
   for (; anIt.More(); anIt.Next()) {
     TopoDS_Face aFace = TopoDS::Face(anIt.Value());
@@ -268,7 +286,7 @@ void GeomAlgoAPI_SketchBuilder::build(
     if (aWires.Size() > 2) {
       TopoDS_Shape anOuterWire = aWires.First();
       aWires.RemoveFirst();
-      sortAreas(aWires, theEdges);
+      sortAreas(aWires, aCurveToIndex);
       aWires.Prepend(anOuterWire);
     }
 
@@ -278,7 +296,7 @@ void GeomAlgoAPI_SketchBuilder::build(
 
       // to make faces equal on different platforms, we will find
       // a vertex lying on an edge with the lowest index in the list of initial edges
-      TopoDS_Vertex aStartVertex = findStartVertex(aWire, aFace, theEdges);
+      TopoDS_Vertex aStartVertex = findStartVertex(aWire, aFace, aCurveToIndex, aCurveToFirst);
 
       TopoDS_Wire aNewWire;
       aBuilder.MakeWire(aNewWire);
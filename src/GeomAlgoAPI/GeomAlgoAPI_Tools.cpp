@@ -21,20 +21,33 @@
 #include "GeomAlgoAPI_MakeShape.h"
 
 #include <TopExp_Explorer.hxx>
+#include <Poly_Polygon3D.hxx>
 #include <Poly_Triangulation.hxx>
 #include <BRep_Tool.hxx>
 #include <TopoDS.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepBuilderAPI_Copy.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepTools.hxx>
+#include <Bnd_Box.hxx>
 
 #include <clocale>
+#include <list>
+#include <sstream>
+
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #include <TCollection_AsciiString.hxx>
 #include <OSD_Path.hxx>
+#include <OSD_ThreadPool.hxx>
 
 #include <GeomAlgoAPI_ShapeTools.h>
 #include <GeomAPI_Shape.h>
 #include <ModelAPI_ResultBody.h>
 #include <ModelAPI_AttributeIntArray.h>
+#include <Locale_Convert.h>
 
 #include <TDataStd_Name.hxx>
 #include <XCAFDoc_DocumentTool.hxx>
@@ -46,23 +59,82 @@ using namespace GeomAlgoAPI_Tools;
 
 namespace {
 
-  // This function computes the triangulation of the given shape if it is not already tessellated.
-  static void computeTriangulation(const TopoDS_Shape& theShape)
+  // Returns the absolute deflection: theDeflection multiplied by the largest dimension
+  // of the bounding box of the shape if theIsRelative.
+  static double absoluteDeflection(const TopoDS_Shape& theShape,
+                                   const double theDeflection,
+                                   const bool theIsRelative)
+  {
+    if (!theIsRelative)
+      return theDeflection;
+    Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
+    Bnd_Box aBndBox;
+    BRepBndLib::Add(theShape, aBndBox);
+    aBndBox.Get(aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+    return Max(Max(aXmax - aXmin, aYmax - aYmin), aZmax - aZmin) * theDeflection;
+  }
+
+  // Returns true if some faces of the shape (or edges, if there are no faces) are not meshed.
+  static bool isMeshMissing(const TopoDS_Shape& theShape)
   {
-    Standard_Boolean isTessellate = Standard_False;
     TopLoc_Location aLoc;
-    for (TopExp_Explorer anExp(theShape, TopAbs_FACE); anExp.More() && !isTessellate; anExp.Next()) {
-      Handle(Poly_Triangulation) aTria = BRep_Tool::Triangulation(TopoDS::Face(anExp.Value()), aLoc);
-      isTessellate = aTria.IsNull();
+    TopExp_Explorer anExp(theShape, TopAbs_FACE);
+    if (anExp.More()) {
+      for (; anExp.More(); anExp.Next()) {
+        if (BRep_Tool::Triangulation(TopoDS::Face(anExp.Current()), aLoc).IsNull())
+          return true;
+      }
+      return false;
+    }
+    for (anExp.Init(theShape, TopAbs_EDGE); anExp.More(); anExp.Next()) {
+      if (BRep_Tool::Polygon3D(TopoDS::Edge(anExp.Current()), aLoc).IsNull())
+        return true;
     }
+    return false;
+  }
 
-    if (isTessellate) {
-      BRepMesh_IncrementalMesh aMesher(theShape, 0.1);
-      Standard_ProgramError_Raise_if(!aMesher.IsDone(), "Meshing failed");
+  // Returns true if all faces of the shape are meshed exactly with theDeflection:
+  // a finer triangulation is not taken, the exported mesh must not depend on the previous ones.
+  static bool isMeshedWith(const TopoDS_Shape& theShape, const double theDeflection)
+  {
+    TopLoc_Location aLoc;
+    TopExp_Explorer anExp(theShape, TopAbs_FACE);
+    if (!anExp.More())
+      return false;
+    for (; anExp.More(); anExp.Next()) {
+      Handle(Poly_Triangulation) aTriangulation =
+        BRep_Tool::Triangulation(TopoDS::Face(anExp.Current()), aLoc);
+      if (aTriangulation.IsNull() ||
+          Abs(aTriangulation->Deflection() - theDeflection) > 1.e-7 * theDeflection)
+        return false;
     }
+    return true;
   }
+
+  // A shape meshed by Mesh_Tools::meshed
+  struct MeshedShape {
+    TopoDS_Shape mySource; ///< keeps the shape, so, it can not be replaced by another one
+    double myDeflection;
+    bool myIsRelative;
+    TopoDS_Shape myMeshed; ///< the meshed copy of the source without location
+  };
+
+  // Number of meshed shapes kept by Mesh_Tools::meshed
+  static const size_t THE_MESH_CACHE_SIZE = 8;
+  // Shapes meshed by Mesh_Tools::meshed, the most recently used first
+  static std::list<MeshedShape> THE_MESH_CACHE;
+
+  // Number of file translations kept by Import_Tools
+  static const size_t THE_IMPORT_CACHE_SIZE = 4;
+  // File translations kept by Import_Tools, the most recently used first
+  static std::list<Import_Tools::TranslatedPtr> THE_IMPORT_CACHE;
 }
 
+// Options of the boolean operations, see BOP_Policy
+static bool THE_BOP_PARALLEL = true;
+static int THE_BOP_NB_THREADS = 0;
+static double THE_BOP_FUZZY = -1.;
+
 Localizer::Localizer()
 {
   myCurLocale = std::setlocale(LC_NUMERIC, 0);
@@ -105,6 +177,189 @@ std::string File_Tools::path(const std::string& theFileName)
   return theFileName.substr(0, aTrekLen);
 }
 
+std::string File_Tools::stamp(const std::string& theFileName)
+{
+  // the modification time: the access time changes on read and may be not updated on write
+#ifdef WIN32
+  // the path is in UTF-8, the narrow API would interpret it in the ANSI code page
+  struct _stat64 aStat;
+  if (_wstat64(Locale::Convert::toWString(theFileName).c_str(), &aStat) != 0)
+    return std::string();
+  long long aNanoSec = 0;
+#else
+  struct stat aStat;
+  if (stat(theFileName.c_str(), &aStat) != 0)
+    return std::string();
+#ifdef __APPLE__
+  long long aNanoSec = aStat.st_mtimespec.tv_nsec;
+#else
+  long long aNanoSec = aStat.st_mtim.tv_nsec;
+#endif
+#endif
+  std::ostringstream aStamp;
+  aStamp << (long long)aStat.st_size << " " << (long long)aStat.st_mtime << "." << aNanoSec;
+  return aStamp.str();
+}
+
+GeomShapePtr Mesh_Tools::meshed(const GeomShapePtr& theShape,
+                                const double theDeflection,
+                                const bool theIsRelative)
+{
+  if (!theShape.get() || theShape->isNull())
+    return theShape;
+  const TopoDS_Shape& aShape = theShape->impl<TopoDS_Shape>();
+  double aDeflection = absoluteDeflection(aShape, theDeflection, theIsRelative);
+  // the source already carries the triangulation: no need to copy it
+  if (isMeshedWith(aShape, aDeflection))
+    return theShape;
+
+  std::list<MeshedShape>& aCache = THE_MESH_CACHE;
+  std::list<MeshedShape>::iterator aCached = aCache.begin();
+  for (; aCached != aCache.end(); ++aCached) {
+    // the location is a part of the key: the relative deflection depends on it
+    if (aCached->mySource.IsSame(aShape) &&
+        aCached->myDeflection == theDeflection && aCached->myIsRelative == theIsRelative)
+      break;
+  }
+  if (aCached == aCache.end()) {
+    MeshedShape aNew;
+    aNew.mySource = aShape;
+    aNew.myDeflection = theDeflection;
+    aNew.myIsRelative = theIsRelative;
+    BRepBuilderAPI_Copy aCopy(aShape.Located(TopLoc_Location()), Standard_False);
+    aNew.myMeshed = aCopy.Shape();
+    BRepTools::Clean(aNew.myMeshed);
+    BRepMesh_IncrementalMesh aMesher(aNew.myMeshed, aDeflection, Standard_False, 0.5,
+                                     Standard_True);
+    aCache.push_front(aNew);
+    if (aCache.size() > THE_MESH_CACHE_SIZE)
+      aCache.pop_back();
+  }
+  else if (aCached != aCache.begin())
+    aCache.splice(aCache.begin(), aCache, aCached);
+
+  TopoDS_Shape aResult =
+    aCache.front().myMeshed.Located(aShape.Location()).Oriented(aShape.Orientation());
+  GeomShapePtr aResultShape(new GeomAPI_Shape);
+  aResultShape->setImpl(new TopoDS_Shape(aResult));
+  return aResultShape;
+}
+
+void Mesh_Tools::clearCache()
+{
+  THE_MESH_CACHE.clear();
+}
+
+void Mesh_Tools::meshIfNone(const GeomShapePtr& theShape,
+                            const double theDeflection,
+                            const bool theIsRelative)
+{
+  if (!theShape.get() || theShape->isNull())
+    return;
+  const TopoDS_Shape& aShape = theShape->impl<TopoDS_Shape>();
+  if (isMeshMissing(aShape)) {
+    BRepMesh_IncrementalMesh aMesher(aShape,
+      absoluteDeflection(aShape, theDeflection, theIsRelative), Standard_False, 0.5, Standard_True);
+    Standard_ProgramError_Raise_if(!aMesher.IsDone(), "Meshing failed");
+  }
+}
+
+Import_Tools::TranslatedPtr Import_Tools::translated(const std::string& theKey,
+                                                     const std::string& theOwner)
+{
+  if (theKey.empty())
+    return TranslatedPtr();
+  std::list<TranslatedPtr>& aCache = THE_IMPORT_CACHE;
+  std::list<TranslatedPtr>::iterator aCached = aCache.begin();
+  for (; aCached != aCache.end() && (*aCached)->myKey != theKey; ++aCached);
+  if (aCached == aCache.end())
+    return TranslatedPtr();
+  if (aCached != aCache.begin())
+    aCache.splice(aCache.begin(), aCache, aCached);
+
+  TranslatedPtr aFound = aCache.front();
+  if (aFound->myOwner == theOwner || !aFound->myShape.get() || aFound->myShape->isNull())
+    return aFound;
+  // another feature gets its own copy: the naming and the colors are stored on the shape
+  TranslatedPtr aCopied(new Translated(*aFound));
+  aCopied->myOwner = theOwner;
+  BRepBuilderAPI_Copy aCopy(aFound->myShape->impl<TopoDS_Shape>());
+  aCopied->myShape.reset(new GeomAPI_Shape);
+  aCopied->myShape->setImpl(new TopoDS_Shape(aCopy.Shape()));
+  std::map<std::wstring, GeomShapePtr>::iterator aNamed = aCopied->myShapeNames.begin();
+  for (; aNamed != aCopied->myShapeNames.end(); ++aNamed) {
+    if (!aNamed->second.get() || aNamed->second->isNull())
+      continue;
+    const TopTools_ListOfShape& aModified = aCopy.Modified(aNamed->second->impl<TopoDS_Shape>());
+    if (aModified.IsEmpty())
+      continue;
+    aNamed->second.reset(new GeomAPI_Shape);
+    aNamed->second->setImpl(new TopoDS_Shape(aModified.First()));
+  }
+  return aCopied;
+}
+
+void Import_Tools::store(const TranslatedPtr& theTranslated)
+{
+  if (!theTranslated.get() || theTranslated->myKey.empty())
+    return;
+  std::list<TranslatedPtr>& aCache = THE_IMPORT_CACHE;
+  std::list<TranslatedPtr>::iterator aCached = aCache.begin();
+  for (; aCached != aCache.end() && (*aCached)->myKey != theTranslated->myKey; ++aCached);
+  if (aCached != aCache.end())
+    aCache.erase(aCached);
+  aCache.push_front(theTranslated);
+  if (aCache.size() > THE_IMPORT_CACHE_SIZE)
+    aCache.pop_back();
+}
+
+void Import_Tools::clearCache()
+{
+  THE_IMPORT_CACHE.clear();
+}
+
+bool BOP_Policy::isParallel()
+{
+  return THE_BOP_PARALLEL;
+}
+
+void BOP_Policy::setParallel(const bool theParallel)
+{
+  THE_BOP_PARALLEL = theParallel;
+}
+
+int BOP_Policy::threadsNumber()
+{
+  return THE_BOP_NB_THREADS;
+}
+
+void BOP_Policy::setThreadsNumber(const int theNbThreads)
+{
+  int aNbThreads = theNbThreads > 0 ? theNbThreads : 0;
+  if (aNbThreads == THE_BOP_NB_THREADS)
+    return;
+  THE_BOP_NB_THREADS = aNbThreads;
+  // the default pool is used by OSD_Parallel when OCCT is built without TBB
+  OSD_ThreadPool::DefaultPool()->Init(aNbThreads > 0 ? aNbThreads : -1);
+}
+
+double BOP_Policy::defaultFuzzy()
+{
+  return THE_BOP_FUZZY;
+}
+
+void BOP_Policy::setDefaultFuzzy(const double theFuzzy)
+{
+  THE_BOP_FUZZY = theFuzzy;
+}
+
+double BOP_Policy::fuzzy(const double theFuzzy, const double theOwnDefault)
+{
+  if (theFuzzy > 0)
+    return theFuzzy;
+  return THE_BOP_FUZZY > 0 ? THE_BOP_FUZZY : theOwnDefault;
+}
+
 bool AlgoError::isAlgorithmFailed(const GeomMakeShapePtr& theAlgorithm,
                                   const std::string& theFeature,
                                   std::string& theError)
@@ -185,8 +440,6 @@ void GeomAlgoAPI_Tools::AttributeExport_Tools::getAttributes(const ResultPtr& th
 void GeomAlgoAPI_Tools::AttributeExport_Tools::putResult(const ResultPtr& theResult, const GeomShapePtr theFatherShape, TDF_Label& theFaterID, GeomAlgoAPI_Attributes& theAttrs)
 {
   GeomShapePtr aShape = theResult->shape();
-  computeTriangulation(aShape->impl<TopoDS_Shape>());
-
   if (!aShape.get() || aShape->isNull())
     return;
   ResultBodyPtr aBody = std::dynamic_pointer_cast<ModelAPI_ResultBody>(theResult);
@@ -27,8 +27,11 @@
 #include <GeomAPI_Shape.h>
 #include <Quantity_Color.hxx>
 
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 class GeomAlgoAPI_MakeShape;
 
@@ -72,6 +75,106 @@ public:
    * Returns a directory path of theFileName
    */
   GEOMALGOAPI_EXPORT static std::string path(const std::string& theFileName);
+  /**
+   * Returns a string identifying the state of theFileName: its size and modification time.
+   * Returns an empty string if the file does not exist.
+   */
+  GEOMALGOAPI_EXPORT static std::string stamp(const std::string& theFileName);
+};
+
+/** \class Mesh_Tools
+ *  \ingroup DataAlgo
+ *  \brief Tessellation of shapes shared by exports and measurements.
+ */
+class Mesh_Tools {
+public:
+  /**
+   * Returns theShape triangulated with theDeflection (relative to the size of the bounding box
+   * if theIsRelative). The source shape is not modified: if it does not carry a triangulation
+   * with exactly this deflection, a copy is meshed in parallel. The last meshed copies are kept,
+   * so, the next requests with the same located shape and parameters do not mesh it again.
+   */
+  GEOMALGOAPI_EXPORT static GeomShapePtr meshed(const GeomShapePtr& theShape,
+                                                const double theDeflection,
+                                                const bool theIsRelative);
+  /// Forgets the meshed copies kept by meshed(), and so, releases their source shapes.
+  GEOMALGOAPI_EXPORT static void clearCache();
+  /**
+   * Meshes theShape in parallel if some of its faces (or edges, if it has no faces)
+   * have no triangulation. The triangulation is stored in the shape.
+   */
+  GEOMALGOAPI_EXPORT static void meshIfNone(const GeomShapePtr& theShape,
+                                            const double theDeflection = 0.1,
+                                            const bool theIsRelative = false);
+};
+
+/** \class Import_Tools
+ *  \ingroup DataAlgo
+ *  \brief Results of the last file translations, kept to avoid reading a file again
+ *  when the import feature is re-executed.
+ */
+class Import_Tools {
+public:
+  /// Result of a file translation
+  struct Translated {
+    std::string myKey; ///< path, size and modification time of the file, import options
+    std::string myOwner; ///< identifier of the feature that translated the file
+    GeomShapePtr myShape;
+    std::map<std::wstring, GeomShapePtr> myShapeNames;
+    std::map<std::wstring, std::vector<int> > myShapeColors;
+    std::map<std::wstring, std::list<std::wstring> > myMaterialShape;
+  };
+  typedef std::shared_ptr<Translated> TranslatedPtr;
+
+  /**
+   * Returns the stored translation with theKey or null. If it was stored by another owner than
+   * theOwner, the returned translation holds a copy of the shape (and of the named sub-shapes):
+   * the results of different features never share the shape.
+   */
+  GEOMALGOAPI_EXPORT static TranslatedPtr translated(const std::string& theKey,
+                                                     const std::string& theOwner);
+  /// Keeps theTranslated among the last translations, does nothing if its key is empty.
+  GEOMALGOAPI_EXPORT static void store(const TranslatedPtr& theTranslated);
+  /// Forgets all kept translations, and so, releases their shapes.
+  GEOMALGOAPI_EXPORT static void clearCache();
+};
+
+/** \class BOP_Policy
+ *  \ingroup DataAlgo
+ *  \brief Execution options applied to all boolean operations of OCCT.
+ */
+class BOP_Policy {
+public:
+  /// Returns true if the boolean operations run in parallel (true by default)
+  GEOMALGOAPI_EXPORT static bool isParallel();
+  /// Enables or disables the parallel mode of the boolean operations
+  GEOMALGOAPI_EXPORT static void setParallel(const bool theParallel);
+
+  /// Returns the number of threads used by the parallel algorithms (0 means all processors)
+  GEOMALGOAPI_EXPORT static int threadsNumber();
+  /// Limits the number of threads used by the parallel algorithms (0 for all processors)
+  GEOMALGOAPI_EXPORT static void setThreadsNumber(const int theNbThreads);
+
+  /// Returns the fuzzy value used when the operation has no fuzzy value defined by the user,
+  /// not positive if each operation keeps its own default
+  GEOMALGOAPI_EXPORT static double defaultFuzzy();
+  /// Sets the fuzzy value used when the operation has no fuzzy value defined by the user
+  GEOMALGOAPI_EXPORT static void setDefaultFuzzy(const double theFuzzy);
+
+  /// Returns theFuzzy if it is positive, otherwise the default of the policy if it is defined,
+  /// otherwise theOwnDefault of the operation
+  GEOMALGOAPI_EXPORT static double fuzzy(const double theFuzzy, const double theOwnDefault = -1.);
+
+  /// Applies the parallel mode and the fuzzy value (if positive) to theAlgo:
+  /// any BOPAlgo algorithm or BRepAlgoAPI operation
+  template<class Algo>
+  static void apply(Algo& theAlgo, const double theFuzzy = -1., const double theOwnDefault = -1.)
+  {
+    theAlgo.SetRunParallel(isParallel());
+    double aFuzzy = fuzzy(theFuzzy, theOwnDefault);
+    if (aFuzzy > 0)
+      theAlgo.SetFuzzyValue(aFuzzy);
+  }
 };
 
 /** \class AlgoError
@@ -67,6 +67,9 @@ bool XAOExport(const std::string& theFileName,
     return false;
   }
 
+  // Set "C" numeric locale to save numbers correctly
+  GeomAlgoAPI_Tools::Localizer loc;
+
   try {
     XAO::BrepGeometry* aGeometry = dynamic_cast<XAO::BrepGeometry*>(theXao->getGeometry());
     TopoDS_Shape aShape = aGeometry->getTopoDS_Shape();
@@ -102,6 +105,9 @@ const std::string XAOExportMem(XAO::Xao* theXao,
     return aRetBuff;
   }
 
+  // Set "C" numeric locale to save numbers correctly
+  GeomAlgoAPI_Tools::Localizer loc;
+
   try {
     XAO::BrepGeometry* aGeometry = dynamic_cast<XAO::BrepGeometry*>(theXao->getGeometry());
     TopoDS_Shape aShape = aGeometry->getTopoDS_Shape();
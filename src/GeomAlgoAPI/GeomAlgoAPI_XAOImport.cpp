@@ -19,6 +19,8 @@
 
 #include <GeomAlgoAPI_XAOImport.h>
 
+#include "GeomAlgoAPI_Tools.h"
+
 #include <TopoDS_Shape.hxx>
 
 #include <XAO_XaoExporter.hxx>
@@ -42,6 +44,9 @@ std::shared_ptr<GeomAPI_Shape> XAOImport(const std::string& theFileName,
   }
 
   TopoDS_Shape aShape;
+  // Set "C" numeric locale to read numbers correctly
+  GeomAlgoAPI_Tools::Localizer loc;
+
   try {
     if (XAO::XaoExporter::readFromFile(theFileName, theXao)) {
       XAO::Geometry* aGeometry = theXao->getGeometry();
@@ -82,6 +87,9 @@ std::shared_ptr<GeomAPI_Shape> XAOImportMem(const std::string& theMemoryBuff,
   }
 
   TopoDS_Shape aShape;
+  // Set "C" numeric locale to read numbers correctly
+  GeomAlgoAPI_Tools::Localizer loc;
+
   try {
     if (XAO::XaoExporter::setXML(theMemoryBuff, theXao)) {
       XAO::Geometry* aGeometry = theXao->getGeometry();
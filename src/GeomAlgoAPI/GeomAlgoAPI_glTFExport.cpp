@@ -46,6 +46,8 @@ bool GLTFExport(const std::string& theFileName,
   std::list<std::shared_ptr<GeomAPI_Shape> >::const_iterator aShape = theShapes.cbegin();
   std::list<std::shared_ptr<ModelAPI_Result> >::const_iterator aResult = theResults.cbegin();
   for (; aShape != theShapes.cend(); aShape++, aResult++) {
+    // glTF contains only the triangulation: mesh the shapes exported for the first time
+    GeomAlgoAPI_Tools::Mesh_Tools::meshIfNone(*aShape);
     TDF_Label aNullLab;
     if (aResult->get() && !(*aShape)->isSame((*aResult)->shape())) { // simple sub-shape
       GeomAlgoAPI_Tools::AttributeExport_Tools::getAttributes(*aResult, anAttrs);
@@ -127,8 +127,10 @@ bool Model_AttributeSelection::setValue(const ObjectPtr& theContext,
   if (isOldShape) return false; // shape is the same, so context is also unchanged
   bool aToUnblock = false;
   // update the referenced object if needed
+  std::set<ObjectPtr> anOldReferenced;
   if (!isOldContext) {
     aToUnblock = !owner()->data()->blockSendAttributeUpdated(true);
+    referencedObjects(anOldReferenced);
     myRef.setValue(theContext);
   }
 
@@ -149,7 +151,10 @@ bool Model_AttributeSelection::setValue(const ObjectPtr& theContext,
   }
   if (!theContext.get() || isDegeneratedEdge) {
     aSelLab.ForgetAllAttributes(true);
+    if (isOldContext)
+      referencedObjects(anOldReferenced);
     myRef.myRef = TDF_Reference::Set(aSelLab.Father(), aSelLab.Father());
+    updateBackReferences(anOldReferenced);
     if (aToUnblock)
       owner()->data()->blockSendAttributeUpdated(false);
     return false;
@@ -192,12 +197,15 @@ bool Model_AttributeSelection::setValue(const ObjectPtr& theContext,
           aFeatureContext->firstResult()->groupName() != ModelAPI_ResultConstruction::group()) {
         aSelLab.ForgetAllAttributes(true);
         myRef.setValue(ObjectPtr());
+        updateBackReferences(anOldReferenced);
         if (aToUnblock)
           owner()->data()->blockSendAttributeUpdated(false);
         return false;
       }
     }
   }
+  if (!isOldContext)
+    updateBackReferences(anOldReferenced);
 
   owner()->data()->sendAttributeUpdated(this);
 
@@ -983,7 +991,10 @@ void Model_AttributeSelection::selectSubShape(
             selectionLabel().ForgetAllAttributes(true);
             bool aToUnblock = false;
             aToUnblock = !owner()->data()->blockSendAttributeUpdated(true);
+            std::set<ObjectPtr> anOldReferenced;
+            referencedObjects(anOldReferenced);
             myRef.setValue(aContext);
+            updateBackReferences(anOldReferenced);
             aSelector.store(aContextShape);
             owner()->data()->sendAttributeUpdated(this);
             if (aToUnblock)
@@ -2219,6 +2230,52 @@ TDF_Label Model_AttributeSelection::baseDocumentLab()
 
 void Model_AttributeSelection::reset()
 {
+  std::set<ObjectPtr> anOldReferenced;
+  referencedObjects(anOldReferenced);
   ModelAPI_AttributeSelection::reset();
   myRef.reset();
+  updateBackReferences(anOldReferenced);
+}
+
+void Model_AttributeSelection::referencedObjects(std::set<ObjectPtr>& theObjects)
+{
+  if (myTmpContext.get() || myTmpSubShape.get())
+    return; // temporary values are not stored in the data structure
+  // the same objects as Model_Data::referencesToObjects returns for the selection
+  std::list<ResultPtr> aResults;
+  FeaturePtr aContextFeature = contextFeature();
+  if (aContextFeature.get())
+    aResults = aContextFeature->results();
+  else
+    aResults.push_back(context());
+  std::list<ResultPtr>::iterator aRes = aResults.begin();
+  for(; aRes != aResults.end(); aRes++) {
+    if (aRes->get() && (*aRes)->data()->isValid())
+      theObjects.insert(*aRes);
+  }
+}
+
+void Model_AttributeSelection::updateBackReferences(const std::set<ObjectPtr>& theOldObjects)
+{
+  std::set<ObjectPtr> aNewObjects;
+  referencedObjects(aNewObjects);
+  // the reference attribute registers the context feature itself, but the selection
+  // refers to the results of the feature
+  FeaturePtr aContextFeature = contextFeature();
+  REMOVE_BACK_REF(aContextFeature);
+  std::set<ObjectPtr>::const_iterator anOld = theOldObjects.cbegin();
+  for(; anOld != theOldObjects.cend(); anOld++) {
+    if (!(*anOld)->data()->isValid() || aNewObjects.find(*anOld) != aNewObjects.end())
+      continue;
+    // other elements of the list are registered by the same attribute identifier
+    if (myParent && myParent->isReferenced(*anOld)) {
+      ADD_BACK_REF((*anOld));
+    } else {
+      REMOVE_BACK_REF((*anOld));
+    }
+  }
+  std::set<ObjectPtr>::iterator aNew = aNewObjects.begin();
+  for(; aNew != aNewObjects.end(); aNew++) {
+    ADD_BACK_REF((*aNew));
+  }
 }
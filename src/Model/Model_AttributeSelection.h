@@ -202,6 +202,14 @@ protected:
     return myIsGeometricalSelection;
   };
 
+  /// Collects the objects referenced by the stored selection: the context result or all
+  /// results of the context feature
+  void referencedObjects(std::set<ObjectPtr>& theObjects);
+
+  /// Registers back references to the currently referenced objects and removes the ones to
+  /// theOldObjects that are not referenced by this attribute or its parent list anymore
+  void updateBackReferences(const std::set<ObjectPtr>& theOldObjects);
+
   /// Returns the module document label if this selection attribute is not in this document.
   /// Returns null label otherwise.
   TDF_Label baseDocumentLab();
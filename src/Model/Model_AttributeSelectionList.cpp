@@ -162,9 +162,11 @@ void Model_AttributeSelectionList::removeLast()
     std::shared_ptr<Model_AttributeSelection> aOldAttr =
       std::shared_ptr<Model_AttributeSelection>(new Model_AttributeSelection(aLab));
     aOldAttr->setObject(owner());
-    REMOVE_BACK_REF(aOldAttr->context());
+    std::set<ObjectPtr> aReferenced;
+    aOldAttr->referencedObjects(aReferenced);
     aLab.ForgetAllAttributes(Standard_True);
     myTmpAttr.reset();
+    removeBackReferences(aReferenced);
     owner()->data()->sendAttributeUpdated(this);
   }
 }
@@ -248,6 +250,7 @@ void Model_AttributeSelectionList::remove(const std::set<int>& theIndices)
 {
   int anOldSize = mySize->Get();
   int aRemoved = 0;
+  std::set<ObjectPtr> aReferenced; // by the removed elements
   // iterate one by one and shifting the removed indices
   for(int aCurrent = 0; aCurrent < anOldSize; aCurrent++) {
     if (theIndices.find(aCurrent) == theIndices.end()) { // not removed
@@ -263,7 +266,7 @@ void Model_AttributeSelectionList::remove(const std::set<int>& theIndices)
       std::shared_ptr<Model_AttributeSelection> aOldAttr =
         std::shared_ptr<Model_AttributeSelection>(new Model_AttributeSelection(aLab));
       aOldAttr->setObject(owner());
-      REMOVE_BACK_REF(aOldAttr->context());
+      aOldAttr->referencedObjects(aReferenced);
       aLab.ForgetAllAttributes(Standard_True);
       myTmpAttr.reset();
       aRemoved++;
@@ -271,6 +274,7 @@ void Model_AttributeSelectionList::remove(const std::set<int>& theIndices)
   }
   if (aRemoved) { // remove was performed, so, update the size and this attribute
     mySize->Set(anOldSize - aRemoved);
+    removeBackReferences(aReferenced);
     owner()->data()->sendAttributeUpdated(this);
   }
 }
@@ -282,6 +286,25 @@ void Model_AttributeSelectionList::copyTo(AttributeSelectionListPtr theTarget) c
   if (aTarget) {
     copyAttrs(myLab, aTarget->myLab);
     aTarget->reinit();
+    // the copied contexts become referenced by the target
+    FeaturePtr anOwner = std::dynamic_pointer_cast<ModelAPI_Feature>(aTarget->owner());
+    for(int anIndex = 0; anOwner.get() && anIndex < aTarget->size(); anIndex++) {
+      std::list<ResultPtr> aContexts;
+      AttributeSelectionPtr anAttr = aTarget->value(anIndex);
+      FeaturePtr aContextFeature = anAttr->contextFeature();
+      if (aContextFeature.get())
+        aContexts = aContextFeature->results();
+      else
+        aContexts.push_back(anAttr->context());
+      std::list<ResultPtr>::iterator aContext = aContexts.begin();
+      for(; aContext != aContexts.end(); aContext++) {
+        if (aContext->get() && (*aContext)->data()->isValid()) {
+          std::shared_ptr<Model_Data> aData =
+            std::dynamic_pointer_cast<Model_Data>((*aContext)->data());
+          aData->addBackReference(anOwner, aTarget->id(), false);
+        }
+      }
+    }
   }
 }
 
@@ -397,6 +420,7 @@ void Model_AttributeSelectionList::clear()
   if (mySize->Get() != 0) {
     mySize->Set(0);
     myTmpAttr.reset();
+    std::set<ObjectPtr> aReferenced; // by the removed elements
     TDF_ChildIterator aSubIter(mySize->Label());
     for(; aSubIter.More(); aSubIter.Next()) {
       TDF_Label aLab = aSubIter.Value();
@@ -406,14 +430,38 @@ void Model_AttributeSelectionList::clear()
         aNewAttr->setObject(owner());
         aNewAttr->setParent(this);
       }
-      REMOVE_BACK_REF(aNewAttr->context());
+      aNewAttr->referencedObjects(aReferenced);
 
       aLab.ForgetAllAttributes(Standard_True);
     }
+    removeBackReferences(aReferenced);
     owner()->data()->sendAttributeUpdated(this);
   }
 }
 
+bool Model_AttributeSelectionList::isReferenced(const ObjectPtr& theObject)
+{
+  for(int anIndex = 0, aSize = size(); anIndex < aSize; anIndex++) {
+    std::shared_ptr<Model_AttributeSelection> anAttr =
+      std::dynamic_pointer_cast<Model_AttributeSelection>(value(anIndex));
+    std::set<ObjectPtr> aReferenced;
+    anAttr->referencedObjects(aReferenced);
+    if (aReferenced.find(theObject) != aReferenced.end())
+      return true;
+  }
+  return false;
+}
+
+void Model_AttributeSelectionList::removeBackReferences(const std::set<ObjectPtr>& theObjects)
+{
+  std::set<ObjectPtr>::const_iterator anObj = theObjects.cbegin();
+  for(; anObj != theObjects.cend(); anObj++) {
+    if ((*anObj)->data()->isValid() && !isReferenced(*anObj)) {
+      REMOVE_BACK_REF((*anObj));
+    }
+  }
+}
+
 bool Model_AttributeSelectionList::isInitialized()
 {
   if (size() == 0) { // empty list is not initialized list: sketch will be not valid after add/undo
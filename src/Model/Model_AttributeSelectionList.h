@@ -27,6 +27,7 @@
 #include <TDataStd_Comment.hxx>
 #include <vector>
 #include <map>
+#include <set>
 
 /**\class Model_AttributeSelectionList
  * \ingroup DataModel
@@ -142,6 +143,12 @@ protected:
   /// if theStart matches with some later attribute and theStart is removed from the list.
   bool merge(Model_AttributeSelection* theStart);
 
+  /// Returns true if some element of the list refers to theObject (by context)
+  bool isReferenced(const ObjectPtr& theObject);
+
+  /// Removes back references of this list from theObjects not referenced by elements anymore
+  void removeBackReferences(const std::set<ObjectPtr>& theObjects);
+
   friend class Model_Data;
   friend class Model_AttributeSelection;
 };
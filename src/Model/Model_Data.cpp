@@ -34,7 +34,9 @@
 #include <Model_AttributeIntArray.h>
 #include <Model_AttributeImage.h>
 #include <Model_AttributeTables.h>
+#include <Model_Document.h>
 #include <Model_Events.h>
+#include <Model_Objects.h>
 #include <Model_Expression.h>
 #include <Model_Tools.h>
 #include <Model_Validator.h>
@@ -67,6 +69,7 @@
 #include <TDF_ChildIDIterator.hxx>
 
 #include <string>
+#include <algorithm>
 
 // myLab contains:
 // TDataStd_Name - name of the object
@@ -177,8 +180,10 @@ void Model_Data::setName(const std::wstring& theName)
   if (mySendAttributeUpdated && isModified)
     ModelAPI_ObjectRenamedMessage::send(myObject, anOldName, theName, this);
   if (isModified && myObject && myObject->document()) {
-    std::dynamic_pointer_cast<Model_Document>(myObject->document())->
-      changeNamingName(anOldName, theName, shapeLab());
+    std::shared_ptr<Model_Document> aDoc =
+      std::dynamic_pointer_cast<Model_Document>(myObject->document());
+    aDoc->changeNamingName(anOldName, theName, shapeLab());
+    aDoc->objects()->nameChanged(theName, myObject);
   }
 #ifdef DEBUG_NAMES
   myObject->myName = theName;
@@ -277,7 +282,15 @@ AttributePtr Model_Data::addAttribute(
 
   if (anAttr) {
     aResult = std::shared_ptr<ModelAPI_Attribute>(anAttr);
-    myAttrs[theID] = std::pair<AttributePtr, int>(aResult, anAttrIndex);
+    std::pair<AttributePtr, int> anAttrAndIndex(aResult, anAttrIndex);
+    std::pair<AttributeMap::iterator, bool> anInserted =
+      myAttrs.insert(AttributeMap::value_type(theID, anAttrAndIndex));
+    if (!anInserted.second) { // re-initialization of the attribute: replace the previous one
+      myAttrIDs.erase(anInserted.first->second.first.get());
+      anInserted.first->second = anAttrAndIndex;
+    }
+    myAttrIDs[anAttr] = &(anInserted.first->first);
+    mySortedAttrs.clear();
     anAttr->setObject(myObject);
     anAttr->setID(theID);
   } else {
@@ -363,7 +376,12 @@ void Model_Data::removeAttributes(const std::string& theGroup)
         aLabsToRemove.Append(aGroup.Value()->Label());
       }
       TCollection_AsciiString anAsciiID(aGroupID->Get() + "__" + anID->Get());
-      myAttrs.erase(anAsciiID.ToCString());
+      AttributeMap::iterator aFound = myAttrs.find(anAsciiID.ToCString());
+      if (aFound != myAttrs.end()) {
+        myAttrIDs.erase(aFound->second.first.get());
+        myAttrs.erase(aFound);
+        mySortedAttrs.clear();
+      }
     }
   }
   for(TDF_LabelList::Iterator aLab(aLabsToRemove); aLab.More(); aLab.Next()) {
@@ -374,6 +392,30 @@ void Model_Data::removeAttributes(const std::string& theGroup)
 void Model_Data::clearAttributes()
 {
   myAttrs.clear();
+  myAttrIDs.clear();
+  mySortedAttrs.clear();
+  myRefsFromMe.clear(); // back references to the cleared attributes are not counted anymore
+}
+
+static bool isLessAttrID(const std::pair<const std::string,
+                                         std::pair<AttributePtr, int> >* theAttr1,
+                         const std::pair<const std::string,
+                                         std::pair<AttributePtr, int> >* theAttr2)
+{
+  return theAttr1->first < theAttr2->first;
+}
+
+const std::vector<Model_Data::AttributeMap::value_type*>& Model_Data::sortedAttributes()
+{
+  if (mySortedAttrs.size() != myAttrs.size()) {
+    mySortedAttrs.clear();
+    mySortedAttrs.reserve(myAttrs.size());
+    AttributeMap::iterator anAttrIt = myAttrs.begin();
+    for (; anAttrIt != myAttrs.end(); anAttrIt++)
+      mySortedAttrs.push_back(&(*anAttrIt));
+    std::sort(mySortedAttrs.begin(), mySortedAttrs.end(), isLessAttrID);
+  }
+  return mySortedAttrs;
 }
 
 
@@ -408,19 +450,18 @@ GET_ATTRIBUTE_BY_ID(ModelAPI_AttributeImage, image);
 
 std::shared_ptr<ModelAPI_Attribute> Model_Data::attribute(const std::string& theID)
 {
-  std::shared_ptr<ModelAPI_Attribute> aResult;
-  if (myAttrs.find(theID) == myAttrs.end())  // no such attribute
-    return aResult;
-  return myAttrs[theID].first;
+  AttributeMap::iterator aFound = myAttrs.find(theID);
+  if (aFound == myAttrs.end())  // no such attribute
+    return std::shared_ptr<ModelAPI_Attribute>();
+  return aFound->second.first;
 }
 
 const std::string& Model_Data::id(const std::shared_ptr<ModelAPI_Attribute>& theAttr)
 {
-  AttributeMap::iterator anAttr = myAttrs.begin();
-  for (; anAttr != myAttrs.end(); anAttr++) {
-    if (anAttr->second.first == theAttr)
-      return anAttr->first;
-  }
+  std::unordered_map<const ModelAPI_Attribute*, const std::string*>::iterator aFound =
+    myAttrIDs.find(theAttr.get());
+  if (aFound != myAttrIDs.end())
+    return *(aFound->second);
   // not found
   static std::string anEmpty;
   return anEmpty;
@@ -442,9 +483,10 @@ bool Model_Data::isValid()
 std::list<std::shared_ptr<ModelAPI_Attribute> > Model_Data::attributes(const std::string& theType)
 {
   std::list<std::shared_ptr<ModelAPI_Attribute> > aResult;
-  AttributeMap::iterator anAttrsIter = myAttrs.begin();
-  for (; anAttrsIter != myAttrs.end(); anAttrsIter++) {
-    AttributePtr anAttr = anAttrsIter->second.first;
+  const std::vector<AttributeMap::value_type*>& anAttrs = sortedAttributes();
+  std::vector<AttributeMap::value_type*>::const_iterator anAttrsIter = anAttrs.begin();
+  for (; anAttrsIter != anAttrs.end(); anAttrsIter++) {
+    AttributePtr anAttr = (*anAttrsIter)->second.first;
     if (theType.empty() || anAttr->attributeType() == theType) {
       aResult.push_back(anAttr);
     }
@@ -455,11 +497,12 @@ std::list<std::shared_ptr<ModelAPI_Attribute> > Model_Data::attributes(const std
 std::list<std::string> Model_Data::attributesIDs(const std::string& theType)
 {
   std::list<std::string> aResult;
-  AttributeMap::iterator anAttrsIter = myAttrs.begin();
-  for (; anAttrsIter != myAttrs.end(); anAttrsIter++) {
-    AttributePtr anAttr = anAttrsIter->second.first;
+  const std::vector<AttributeMap::value_type*>& anAttrs = sortedAttributes();
+  std::vector<AttributeMap::value_type*>::const_iterator anAttrsIter = anAttrs.begin();
+  for (; anAttrsIter != anAttrs.end(); anAttrsIter++) {
+    AttributePtr anAttr = (*anAttrsIter)->second.first;
     if (theType.empty() || anAttr->attributeType() == theType) {
-      aResult.push_back(anAttrsIter->first);
+      aResult.push_back((*anAttrsIter)->first);
     }
   }
   return aResult;
@@ -536,6 +579,12 @@ void Model_Data::erase()
 {
   if (!myLab.IsNull()) {
     if (myLab.HasAttribute()) {
+      if (myObject && myObject->document()) { // the erased object is not found by name anymore
+        std::shared_ptr<Model_Document> aDoc =
+          std::dynamic_pointer_cast<Model_Document>(myObject->document());
+        if (aDoc.get() && aDoc->objects())
+          aDoc->objects()->nameRemoved(myObject);
+      }
       // remove in order to clear back references in other objects
       std::list<std::pair<std::string, std::list<ObjectPtr> > > aRefs;
       referencesToObjects(aRefs);
@@ -552,7 +601,7 @@ void Model_Data::erase()
         }
       }
     }
-    myAttrs.clear();
+    clearAttributes();
     myLab.ForgetAllAttributes();
   }
 }
@@ -627,6 +676,18 @@ int Model_Data::featureId() const
   return myLab.Father().Tag(); // tag of the feature label
 }
 
+/// Registers the change of the back reference in the objects manager of the referencing object:
+/// it is synchronized with the attributes in the end of the operation
+static void backReferenceChanged(const ObjectPtr& theOwner, const ObjectPtr& theReferenced)
+{
+  if (theOwner.get()) {
+    std::shared_ptr<Model_Document> aDoc =
+      std::dynamic_pointer_cast<Model_Document>(theOwner->document());
+    if (aDoc.get() && aDoc->objects())
+      aDoc->objects()->backReferenceChanged(theOwner, theReferenced);
+  }
+}
+
 void Model_Data::removeBackReference(ObjectPtr theObject, std::string theAttrID)
 {
   AttributePtr anAttribute = theObject->data()->attribute(theAttrID);
@@ -639,6 +700,17 @@ void Model_Data::removeBackReference(AttributePtr theAttr)
     return;
 
   myRefsToMe.erase(theAttr);
+  backReferenceChanged(theAttr->owner(), myObject);
+
+  if (theAttr->owner().get()) {
+    std::shared_ptr<Model_Data> anOwnerData =
+      std::dynamic_pointer_cast<Model_Data>(theAttr->owner()->data());
+    if (anOwnerData.get()) {
+      RefsFromMe::iterator aFound = anOwnerData->myRefsFromMe.find(myObject);
+      if (aFound != anOwnerData->myRefsFromMe.end() && --(aFound->second) == 0)
+        anOwnerData->myRefsFromMe.erase(aFound);
+    }
+  }
 
   // remove concealment immediately: on deselection it must be possible to reselect in GUI the same
   FeaturePtr aFeatureOwner = std::dynamic_pointer_cast<ModelAPI_Feature>(theAttr->owner());
@@ -669,8 +741,14 @@ void Model_Data::addBackReference(ObjectPtr theObject, std::string theAttrID)
 {
   // it is possible to add the same attribute twice: may be last time the owner was not Stable...
   AttributePtr anAttribute = theObject->data()->attribute(theAttrID);
-  if (myRefsToMe.find(anAttribute) == myRefsToMe.end())
+  if (myRefsToMe.find(anAttribute) == myRefsToMe.end()) {
     myRefsToMe.insert(anAttribute);
+    backReferenceChanged(theObject, myObject);
+    std::shared_ptr<Model_Data> anOwnerData =
+      std::dynamic_pointer_cast<Model_Data>(theObject->data());
+    if (anOwnerData.get() && anOwnerData->isValid())
+      anOwnerData->myRefsFromMe[myObject]++;
+  }
 }
 
 void Model_Data::updateConcealmentFlag()
@@ -755,10 +833,11 @@ void Model_Data::referencesToObjects(
     static_cast<Model_ValidatorsFactory*>(ModelAPI_Session::get()->validators());
   FeaturePtr aMyFeature = std::dynamic_pointer_cast<ModelAPI_Feature>(myObject);
 
-  AttributeMap::iterator anAttrIt = myAttrs.begin();
+  const std::vector<AttributeMap::value_type*>& anAttrs = sortedAttributes();
+  std::vector<AttributeMap::value_type*>::const_iterator anAttrIt = anAttrs.begin();
   std::list<ObjectPtr> aReferenced; // not inside of cycle to avoid excess memory management
-  for(; anAttrIt != myAttrs.end(); anAttrIt++) {
-    AttributePtr anAttr = anAttrIt->second.first;
+  for(; anAttrIt != anAttrs.end(); anAttrIt++) {
+    AttributePtr anAttr = (*anAttrIt)->second.first;
     // skip not-case attributes, that really may refer to anything not-used (issue 671)
     if (aMyFeature.get() && !aValidators->isCase(aMyFeature, anAttr->id()))
       continue;
@@ -851,7 +930,7 @@ void Model_Data::referencesToObjects(
 
     if (!aReferenced.empty()) {
       theRefs.push_back(
-          std::pair<std::string, std::list<ObjectPtr> >(anAttrIt->first, aReferenced));
+          std::pair<std::string, std::list<ObjectPtr> >((*anAttrIt)->first, aReferenced));
       aReferenced.clear();
     }
   }
@@ -863,8 +942,26 @@ void Model_Data::copyTo(std::shared_ptr<ModelAPI_Data> theTarget)
   Model_Tools::copyAttrs(myLab, aTargetRoot);
   // reinitialize Model_Attributes by TDF_Attributes set
   std::shared_ptr<Model_Data> aTData = std::dynamic_pointer_cast<Model_Data>(theTarget);
-  aTData->myAttrs.clear();
+  aTData->clearAttributes();
   theTarget->owner()->initAttributes(); // reinitialize feature attributes
+  // references are copied directly in the data structure: register the back references
+  FeaturePtr aTargetFeature = std::dynamic_pointer_cast<ModelAPI_Feature>(theTarget->owner());
+  std::list<std::pair<std::string, std::list<ObjectPtr> > > aRefs;
+  aTData->referencesToObjects(aRefs);
+  std::list<std::pair<std::string, std::list<ObjectPtr> > >::iterator aRefIter = aRefs.begin();
+  for(; aRefIter != aRefs.end(); aRefIter++) {
+    std::list<ObjectPtr>::iterator aReferenced = aRefIter->second.begin();
+    for(; aReferenced != aRefIter->second.end(); aReferenced++) {
+      if (aReferenced->get() && (*aReferenced)->data()->isValid()) {
+        std::shared_ptr<Model_Data> aData =
+          std::dynamic_pointer_cast<Model_Data>((*aReferenced)->data());
+        if (aTargetFeature.get())
+          aData->addBackReference(aTargetFeature, aRefIter->first, false);
+        else
+          aData->addBackReference(theTarget->owner(), aRefIter->first);
+      }
+    }
+  }
 }
 
 bool Model_Data::isInHistory()
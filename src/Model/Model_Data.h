@@ -45,6 +45,7 @@
 #include <memory>
 
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <string>
 #include <vector>
@@ -60,20 +61,36 @@ class ModelAPI_Attribute;
 
 class Model_Data : public ModelAPI_Data
 {
-  typedef std::map<std::string, std::pair<std::shared_ptr<ModelAPI_Attribute>, int> > AttributeMap;
+  typedef std::unordered_map<std::string,
+    std::pair<std::shared_ptr<ModelAPI_Attribute>, int> > AttributeMap;
+ public:
+  /// Objects referenced by the attributes of the data with the number of referencing attributes
+  typedef std::map<std::weak_ptr<ModelAPI_Object>, int,
+                   std::owner_less<std::weak_ptr<ModelAPI_Object> > > RefsFromMe;
+ private:
 
   TDF_Label myLab;  ///< label of the feature in the document
   /// All attributes of the object identified by the attribute ID
   /// (the attribute is stored together with its index in the feature)
   AttributeMap myAttrs;
+  /// Identifiers of the attributes of myAttrs (pointers to the keys of myAttrs) by the attribute
+  std::unordered_map<const ModelAPI_Attribute*, const std::string*> myAttrIDs;
+  /// Elements of myAttrs sorted by the attribute ID: built on demand for iteration over
+  /// all attributes to keep the order independent of hashing, reset on change of myAttrs
+  std::vector<AttributeMap::value_type*> mySortedAttrs;
   /// Array of flags of this data
   Handle(TDataStd_BooleanArray) myFlags;
 
   /// needed here to emit signal that object changed on change of the attribute
   ObjectPtr myObject;
 
-  /// List of attributes referenced to owner (updated only during the transaction change)
+  /// List of attributes referenced to owner (updated on change of the referencing attributes
+  /// and by synchronization of the document on undo/redo/open)
   std::set<AttributePtr> myRefsToMe;
+  /// Objects referenced by attributes of this data with the number of the referencing attributes:
+  /// it is updated together with myRefsToMe of the referenced objects; weak to not keep the
+  /// removed objects alive
+  RefsFromMe myRefsFromMe;
   /// flag that may block the "attribute updated" sending
   bool mySendAttributeUpdated;
   /// if some attribute was changed, but mySendAttributeUpdated was false, this stores this
@@ -261,6 +278,10 @@ class Model_Data : public ModelAPI_Data
   /// returns all objects referenced to this
   MODEL_EXPORT virtual const std::set<AttributePtr>& refsToMe() {return myRefsToMe;}
 
+  /// returns objects referenced by attributes of this data with the number of
+  /// such attributes
+  const RefsFromMe& refsFromMe() {return myRefsFromMe;}
+
   /// returns all references by attributes of this data
   /// \param theRefs returned list of pairs:
   ///                id of referenced attribute and list of referenced objects
@@ -303,6 +324,9 @@ protected:
   /// Erases all attributes from myAttrs, but keeping them in the data structure
   void clearAttributes();
 
+  /// Returns elements of myAttrs sorted by the attribute ID
+  const std::vector<AttributeMap::value_type*>& sortedAttributes();
+
 private:
   /// Removes a back reference (with identifier which attribute references to this object)
   /// \param theFeature feature referenced to this
@@ -33,6 +33,9 @@
 #include <Events_Loop.h>
 #include <Events_InfoMessage.h>
 #include <GeomAPI_Tools.h>
+#include <GeomAlgoAPI_Tools.h>
+#include <Selector_FilterByNeighbors.h>
+#include <Selector_NExplode.h>
 
 #include <Locale_Convert.h>
 
@@ -636,6 +639,11 @@ void Model_Document::close(const bool theForever)
     if (myDoc->CanClose() == CDM_CCS_OK)
       myDoc->Close();
     mySelectionFeature.reset();
+    // the meshes kept for the exports refer to the shapes of the closed document
+    GeomAlgoAPI_Tools::Mesh_Tools::clearCache();
+    // as well as the adjacency graphs and the sorted sub-shapes of the selection contexts
+    Selector_FilterByNeighbors::clearCache();
+    Selector_NExplode::clearCache();
   } else {
     setCurrentFeature(FeaturePtr(), false); // disables all features
     // update the OB: features are disabled (on remove of Part)
@@ -818,7 +826,7 @@ bool Model_Document::finishOperation()
     std::static_pointer_cast<Model_Session>(Model_Session::get());
 
   // open transaction if nested is closed to fit inside
-  // all synchronizeBackRefs and flushed consequences
+  // all synchronizeChangedBackRefs and flushed consequences
   if (isNestedClosed) {
     myDoc->OpenCommand();
   }
@@ -835,16 +843,11 @@ bool Model_Document::finishOperation()
     if (aMain.get() && aMain != aCurrent)
       setCurrentFeature(aMain, false);
   }
-  myObjs->synchronizeBackRefs();
+  // back references are registered by the attributes: synchronize only the changed ones
+  myObjs->synchronizeChangedBackRefs();
   Events_Loop* aLoop = Events_Loop::loop();
-  static const Events_ID kCreatedEvent = aLoop->eventByName(EVENT_OBJECT_CREATED);
-  static const Events_ID kUpdatedEvent = aLoop->eventByName(EVENT_OBJECT_UPDATED);
-  static const Events_ID kRedispEvent = aLoop->eventByName(EVENT_OBJECT_TO_REDISPLAY);
-  static const Events_ID kDeletedEvent = aLoop->eventByName(EVENT_OBJECT_DELETED);
-  aLoop->flush(kCreatedEvent);
-  aLoop->flush(kUpdatedEvent);
-  aLoop->flush(kRedispEvent);
-  aLoop->flush(kDeletedEvent);
+  // created, updated, redisplayed and deleted in the order declared by the session
+  aLoop->flushAll();
 
   if (isNestedClosed) {
     if (myDoc->CommitCommand())
@@ -862,14 +865,10 @@ bool Model_Document::finishOperation()
 
   // for open of document with primitive box inside (finish transaction in initAttributes)
   bool aWasActivatedFlushes = aLoop->activateFlushes(true);
-  while(aLoop->hasGrouppedEvent(kCreatedEvent) || aLoop->hasGrouppedEvent(kUpdatedEvent) ||
-        aLoop->hasGrouppedEvent(kRedispEvent) || aLoop->hasGrouppedEvent(kDeletedEvent)) {
-    aLoop->flush(kCreatedEvent);
-    aLoop->flush(kUpdatedEvent);
-    aLoop->flush(kRedispEvent);
-    aLoop->flush(kDeletedEvent);
-  }
+  aLoop->flushAll();
   aLoop->activateFlushes(aWasActivatedFlushes);
+  // results appeared in the flushed updates of the created features are not referenced yet
+  myObjs->myCreatedFeatures.clear();
 
   // to avoid "updated" message appearance by updater
   //aLoop->clear(Events_Loop::eventByName(EVENT_OBJECT_UPDATED));
@@ -1002,6 +1001,7 @@ void Model_Document::abortOperation()
     subDoc(*aSubIter)->abortOperation();
   // references may be changed because they are set in attributes on the fly
   myObjs->synchronizeFeatures(aDeltaLabels, true, false, false, isRoot());
+  myObjs->myCreatedFeatures.clear();
 }
 
 bool Model_Document::isOperation() const
@@ -2335,6 +2335,11 @@ bool Model_Document::isLater(FeaturePtr theLater, FeaturePtr theCurrent) const
   return myObjs->isLater(theLater, theCurrent);
 }
 
+int Model_Document::featureIndex(FeaturePtr theFeature) const
+{
+  return myObjs->featureIndex(theFeature);
+}
+
 // Object Browser nodes states
 // LCOV_EXCL_START
 void Model_Document::storeNodesState(const std::list<bool>& theStates)
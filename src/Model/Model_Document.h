@@ -319,6 +319,9 @@ class Model_Document : public ModelAPI_Document
   /// Returns true if theLater is in history of features creation later than theCurrent
   MODEL_EXPORT virtual bool isLater(FeaturePtr theLater, FeaturePtr theCurrent) const;
 
+  /// Returns the position of the feature in history of features creation, or -1 if not found
+  MODEL_EXPORT virtual int featureIndex(FeaturePtr theFeature) const;
+
   /// Just removes all features without touching the document data (to be able undo)
   MODEL_EXPORT virtual void eraseAllFeatures();
 
@@ -431,6 +434,7 @@ class Model_Document : public ModelAPI_Document
   friend class Model_SelectionInResult;
   friend class Model_SelectionNaming;
   friend class Model_BodyBuilder;
+  friend class Model_Data;
   friend class DFBrowser;
 
  private:
@@ -25,8 +25,11 @@
 
 #include "GeomAPI_Edge.h"
 
+#include <OSD_Parallel.hxx>
+
 #include <unordered_map>
 #include <stack>
+#include <vector>
 
 typedef std::unordered_map<GeomShapePtr, ResultBodyPtr,
                           GeomAPI_Shape::Hash, GeomAPI_Shape::Equal> DataMapOfShapesToResults;
@@ -106,31 +109,19 @@ static void fillMapOfShapesToResults(DataMapOfShapesToResults& theMap,
 
 }
 
-bool Model_FiltersFactory::isValid(FeaturePtr theFiltersFeature,
-                                   ResultPtr theResult,
-                                   GeomShapePtr theShape)
+/// Collects the filters of the feature with their reverse flags and the arguments of filters
+static void compileFilters(const std::map<std::string, FilterPtr>& theRegistered,
+                           FeaturePtr theFiltersFeature,
+                           std::list<FilterArgs>& theFilters,
+                           ModelAPI_FiltersArgs& theArgs)
 {
-  // check that the shape type corresponds to the attribute list type
-  AttributePtr aBase =
-    std::dynamic_pointer_cast<ModelAPI_FiltersFeature>(theFiltersFeature)->baseAttribute();
-  if (aBase.get()) {
-    std::shared_ptr<ModelAPI_AttributeSelectionList> aList =
-      std::dynamic_pointer_cast<ModelAPI_AttributeSelectionList>(aBase);
-    std::string aStrType = aList->selectionType();
-    GeomAPI_Shape::ShapeType aType = GeomAPI_Shape::shapeTypeByStr(aStrType);
-    if (theShape->shapeType() != aType)
-      return false;
-  }
-  // prepare all filters args
-  ModelAPI_FiltersArgs anArgs;
-  std::list<FilterArgs> aFilters; /// all filters and the reverse values
-
   std::list<std::string> aGroups;
   theFiltersFeature->data()->allGroups(aGroups);
   for(std::list<std::string>::iterator aGIter = aGroups.begin(); aGIter != aGroups.end(); aGIter++)
   {
     std::string aPureID = pureFilterID(*aGIter);
-    if (myFilters.find(aPureID) == myFilters.end())
+    std::map<std::string, FilterPtr>::const_iterator aFilter = theRegistered.find(aPureID);
+    if (aFilter == theRegistered.end())
       continue;
     std::list<std::shared_ptr<ModelAPI_Attribute> > anAttrs;
     theFiltersFeature->data()->attributesOfGroup(*aGIter, anAttrs);
@@ -140,20 +131,27 @@ bool Model_FiltersFactory::isValid(FeaturePtr theFiltersFeature,
       if (anArgID.empty()) { // reverse flag
         std::shared_ptr<ModelAPI_AttributeBoolean> aReverse =
           std::dynamic_pointer_cast<ModelAPI_AttributeBoolean>(*anAttrIter);
-        FilterArgs aFArgs = { myFilters[aPureID] , aReverse->value() , *aGIter };
-        aFilters.push_back(aFArgs);
+        FilterArgs aFArgs = { aFilter->second , aReverse->value() , *aGIter };
+        theFilters.push_back(aFArgs);
 
       } else {
-        anArgs.add(*anAttrIter);
+        theArgs.add(*anAttrIter);
       }
     }
   }
+}
 
+/// Returns true if the shape is accepted by all the compiled filters
+static bool isAccepted(const std::list<FilterArgs>& theFilters,
+                       ModelAPI_FiltersArgs& theArgs,
+                       const ResultPtr& theResult,
+                       const GeomShapePtr& theShape)
+{
   // iterate filters and check shape for validity for all of them
-  std::list<FilterArgs>::iterator aFilter = aFilters.begin();
-  for(; aFilter != aFilters.end(); aFilter++) {
-    anArgs.setFilter(aFilter->myFilterID);
-    bool aResult = aFilter->myFilter->isOk(theShape, theResult, anArgs);
+  std::list<FilterArgs>::const_iterator aFilter = theFilters.begin();
+  for(; aFilter != theFilters.end(); aFilter++) {
+    theArgs.setFilter(aFilter->myFilterID);
+    bool aResult = aFilter->myFilter->isOk(theShape, theResult, theArgs);
 
     if (aFilter->myReverse)
       aResult = !aResult;
@@ -164,14 +162,95 @@ bool Model_FiltersFactory::isValid(FeaturePtr theFiltersFeature,
   return true;
 }
 
+/// Shapes of a body to check by filters, with the results containing them
+typedef std::list< std::pair<ResultPtr, GeomShapePtr> > ListOfShapes;
+
+/// Functor for the parallel check of the shapes of independent bodies
+class Model_SelectFunctor
+{
+public:
+  Model_SelectFunctor(const std::list<FilterArgs>& theFilters,
+                      const ModelAPI_FiltersArgs& theArgs,
+                      const std::vector<ResultBodyPtr>& theBodies,
+                      const std::vector<GeomShapePtr>& theBodyShapes,
+                      const std::vector<ListOfShapes>& theCandidates,
+                      std::vector<ListOfShapes>& theAccepted)
+    : myFilters(theFilters), myArgs(theArgs), myBodies(theBodies), myBodyShapes(theBodyShapes),
+      myCandidates(theCandidates), myAccepted(theAccepted) {}
+
+  void operator()(const int theIndex) const
+  {
+    // the current filter ID is changed during the check: a copy per body
+    ModelAPI_FiltersArgs anArgs = myArgs;
+    anArgs.setOwner(myBodies[theIndex], myBodyShapes[theIndex]);
+    ListOfShapes::const_iterator aShapesIt = myCandidates[theIndex].cbegin();
+    for (; aShapesIt != myCandidates[theIndex].cend(); aShapesIt++) {
+      if (isAccepted(myFilters, anArgs, aShapesIt->first, aShapesIt->second))
+        myAccepted[theIndex].push_back(*aShapesIt);
+    }
+  }
+
+private:
+  const std::list<FilterArgs>& myFilters;
+  const ModelAPI_FiltersArgs& myArgs;
+  const std::vector<ResultBodyPtr>& myBodies;
+  const std::vector<GeomShapePtr>& myBodyShapes;
+  const std::vector<ListOfShapes>& myCandidates;
+  std::vector<ListOfShapes>& myAccepted;
+};
+
+/// Returns false if the shape type does not correspond to the type of the attribute list
+static bool isSelectionType(FeaturePtr theFiltersFeature, GeomAPI_Shape::ShapeType theType)
+{
+  AttributePtr aBase =
+    std::dynamic_pointer_cast<ModelAPI_FiltersFeature>(theFiltersFeature)->baseAttribute();
+  if (aBase.get()) {
+    std::shared_ptr<ModelAPI_AttributeSelectionList> aList =
+      std::dynamic_pointer_cast<ModelAPI_AttributeSelectionList>(aBase);
+    std::string aStrType = aList->selectionType();
+    return theType == GeomAPI_Shape::shapeTypeByStr(aStrType);
+  }
+  return true;
+}
+
+bool Model_FiltersFactory::isValid(FeaturePtr theFiltersFeature,
+                                   ResultPtr theResult,
+                                   GeomShapePtr theShape)
+{
+  // check that the shape type corresponds to the attribute list type
+  if (!isSelectionType(theFiltersFeature, theShape->shapeType()))
+    return false;
+  // prepare all filters args
+  ModelAPI_FiltersArgs anArgs;
+  std::list<FilterArgs> aFilters; /// all filters and the reverse values
+  compileFilters(myFilters, theFiltersFeature, aFilters, anArgs);
+  anArgs.setCache(myCache);
+
+  return isAccepted(aFilters, anArgs, theResult, theShape);
+}
+
 std::list< std::pair<ResultPtr, GeomShapePtr> > Model_FiltersFactory::select
 (const FiltersFeaturePtr& theFilterFeature,
  const GeomAPI_Shape::ShapeType theShapeType)
 {
   std::list< std::pair<ResultPtr, GeomShapePtr> > aResList;
 
+  // check that the shape type corresponds to the attribute list type
+  if (!isSelectionType(theFilterFeature, theShapeType))
+    return aResList;
+  // filters and their arguments are collected once for all the checked shapes
+  ModelAPI_FiltersArgs anArgs;
+  std::list<FilterArgs> aFilters; /// all filters and the reverse values
+  compileFilters(myFilters, theFilterFeature, aFilters, anArgs);
+  anArgs.setCache(myCache);
+
+  // collect shapes of all bodies to check: the data model is accessed in the main thread only
   DocumentPtr aDoc = theFilterFeature->document();
   int aNb = aDoc->size(ModelAPI_ResultBody::group());
+  std::vector<ListOfShapes> aCandidates(aNb);
+  // the root bodies are the owners of the checked shapes, used by filters
+  std::vector<ResultBodyPtr> aBodies(aNb);
+  std::vector<GeomShapePtr> aBodyShapes(aNb);
   ObjectPtr aObj;
   ResultBodyPtr aBody;
   for (int i = 0; i < aNb; i++) 
@@ -182,6 +261,8 @@ std::list< std::pair<ResultPtr, GeomShapePtr> > Model_FiltersFactory::select
     fillMapOfShapesToResults(aShapeToResMap, aBody, theShapeType);
 
     GeomShapePtr aShape = aBody->shape();
+    aBodies[i] = aBody;
+    aBodyShapes[i] = aShape;
     std::list<GeomShapePtr> aSubShapes = aShape->subShapes(theShapeType, true);
     std::list<GeomShapePtr>::const_iterator aShapesIt;
     for (aShapesIt = aSubShapes.cbegin(); aShapesIt != aSubShapes.cend(); aShapesIt++)
@@ -193,17 +274,29 @@ std::list< std::pair<ResultPtr, GeomShapePtr> > Model_FiltersFactory::select
           continue;
 
 
-      if (aShapeToResMap.find(aSubShape) != aShapeToResMap.end()) 
-      {
-        ResultBodyPtr aResBody = aShapeToResMap[aSubShape];
-        if(this->isValid(theFilterFeature, aResBody, aSubShape))
-        {
-           std::pair<ResultPtr, GeomShapePtr> aPair(aResBody, aSubShape);
-          aResList.push_back(aPair);
-        }
-      }
+      DataMapOfShapesToResults::iterator aResIt = aShapeToResMap.find(aSubShape);
+      if (aResIt != aShapeToResMap.end())
+        aCandidates[i].push_back(std::pair<ResultPtr, GeomShapePtr>(aResIt->second, aSubShape));
     }
   }
+
+  // bodies are independent: check them in parallel if all filters allow it
+  bool isParallel = aNb > 1;
+  std::list<FilterArgs>::const_iterator aFilter = aFilters.cbegin();
+  for (; aFilter != aFilters.cend() && isParallel; aFilter++)
+    isParallel = aFilter->myFilter->isThreadSafe();
+
+  std::vector<ListOfShapes> anAccepted(aNb);
+  Model_SelectFunctor aFunctor(aFilters, anArgs, aBodies, aBodyShapes, aCandidates, anAccepted);
+  if (isParallel)
+    OSD_Parallel::For(0, aNb, aFunctor);
+  else {
+    for (int i = 0; i < aNb; i++)
+      aFunctor(i);
+  }
+
+  for (int i = 0; i < aNb; i++)
+    aResList.splice(aResList.end(), anAccepted[i]);
   return aResList;
 }
 
@@ -22,6 +22,7 @@
 
 #include "Model.h"
 
+#include <ModelAPI_FiltersCache.h>
 #include <ModelAPI_FiltersFactory.h>
 
 #include <map>
@@ -66,10 +67,11 @@ public:
 
 protected:
   /// Get instance from Session
-  Model_FiltersFactory() {}
+  Model_FiltersFactory() : myCache(new ModelAPI_FiltersCache) {}
 
 private:
   std::map<std::string, FilterPtr> myFilters;  ///< map from ID to registered filters
+  FiltersCachePtr myCache; ///< data computed by filters, kept between the checks of shapes
 
   friend class Model_Session;
 };
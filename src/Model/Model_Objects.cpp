@@ -113,7 +113,8 @@ static const int TAG_RESULT_COLORED_SUBSHAPES = 2;  ///< where the shapes are lo
 /// 0:1:2:N:2:K:1 - data of the K result of the feature N
 /// 0:1:2:N:2:K:2:M:1 - data of the M sub-shape of the K result of the feature N
 
-Model_Objects::Model_Objects(TDF_Label theMainLab) : myMain(theMainLab)
+Model_Objects::Model_Objects(TDF_Label theMainLab)
+  : myMain(theMainLab), myFeatureIndexed(false), myNamesIndexed(false), myIsAllBackRefs(false)
 {
 }
 
@@ -220,11 +221,14 @@ void Model_Objects::addFeature(FeaturePtr theFeature, const FeaturePtr theAfterT
         aParentFolder = inFolder(afterThis, ModelAPI_Folder::LAST_FEATURE_ID());
       }
     }
+    int aChangedFrom = featureIndex(aPrevFeateureLab) + 1;
     AddToRefArray(aFeaturesLab, aFeatureLab, aPrevFeateureLab);
+    updateFeatureIndex(aChangedFrom);
 
     // keep the feature ID to restore document later correctly
     TDataStd_Comment::Set(aFeatureLab, theFeature->getKind().c_str());
     myFeatures.Bind(aFeatureLab, theFeature);
+    myCreatedFeatures.insert(theFeature);
     // must be before the event sending: for OB the feature is already added
     updateHistory(ModelAPI_Feature::group());
     // do not change the order:
@@ -358,7 +362,9 @@ void Model_Objects::removeFeature(FeaturePtr theFeature)
     // erase all attributes under the label of feature
     aFeatureLabel.ForgetAllAttributes();
     // remove it from the references array
-    RemoveFromRefArray(featuresLabel(), aFeatureLabel);
+    int aChangedFrom = RemoveFromRefArray(featuresLabel(), aFeatureLabel);
+    myFeatureIndex.UnBind(aFeatureLabel);
+    updateFeatureIndex(aChangedFrom);
     // event: feature is deleted
     ModelAPI_EventCreator::get()->sendDeleted(theFeature->document(), ModelAPI_Feature::group());
     updateHistory(ModelAPI_Feature::group());
@@ -391,6 +397,14 @@ void Model_Objects::eraseAllFeatures()
   kCreator->sendDeleted(myDoc, ModelAPI_Feature::group());
   myFeatures.Clear(); // just remove features without modification of DS
   myHistory.clear();
+  myFeatureIndex.Clear();
+  myFeatureIndexed = false;
+  myNames.clear();
+  myNamesIndexed = false;
+  myChangedRefs.clear();
+  myChangedReferenced.clear();
+  myCreatedFeatures.clear();
+  myIsAllBackRefs = false;
 }
 
 void Model_Objects::moveFeature(FeaturePtr theMoved, FeaturePtr theAfterThis)
@@ -438,8 +452,11 @@ void Model_Objects::moveFeature(FeaturePtr theMoved, FeaturePtr theAfterThis)
     }
     return;
   }
+  // the positions are changed between the old and the new places of the moved feature
+  int aChangedFrom = Min(featureIndex(aMovedLab), featureIndex(anAfterLab) + 1);
   // store the new array
   aRefs->SetInternalArray(aNewArray);
+  updateFeatureIndex(aChangedFrom);
   // update the feature and the history
   clearHistory(theMoved);
   // make sure all (selection) attributes of moved feature will be updated
@@ -649,6 +666,43 @@ std::shared_ptr<ModelAPI_Object> Model_Objects::objectByName(
     const std::string& theGroupID, const std::wstring& theName)
 {
   createHistory(theGroupID);
+  ObjectPtr aResult;
+  std::list<FeaturePtr> aFeatures;
+  featuresByName(theName, aFeatures);
+  // from the end to find the latest object with such name
+  std::list<FeaturePtr>::iterator aFeat = aFeatures.begin();
+  for(; aFeat != aFeatures.end() && !aResult.get(); aFeat++) {
+    if (theGroupID == ModelAPI_Feature::group()) { // searching among features
+      if ((*aFeat)->data()->name() == theName)
+        aResult = *aFeat;
+    } else { // searching among results (concealed or not)
+      std::list<ResultPtr> allRes;
+      ModelAPI_Tools::allResults(*aFeat, allRes);
+      for(std::list<ResultPtr>::iterator aRes = allRes.begin(); aRes != allRes.end(); aRes++) {
+        if (aRes->get() && (*aRes)->groupName() == theGroupID) {
+          if ((*aRes)->data()->name() == theName) {
+            aResult = *aRes;
+            break;
+          }
+        }
+      }
+    }
+  }
+#ifdef DEBUG_NAMES_INDEX
+  ObjectPtr aScanned = objectByNameScan(theGroupID, theName);
+  if (aResult != aScanned) { // the linear search is the reference
+    Events_InfoMessage("Model_Objects", "Names index error: object '%1' of group '%2'")
+      .arg(theName).arg(theGroupID).send();
+    aResult = aScanned;
+  }
+#endif
+  return aResult;
+}
+
+#ifdef DEBUG_NAMES_INDEX
+ObjectPtr Model_Objects::objectByNameScan(
+    const std::string& theGroupID, const std::wstring& theName)
+{
   if (theGroupID == ModelAPI_Feature::group()) { // searching among features (in history or not)
     std::list<std::shared_ptr<ModelAPI_Feature> > allObjs = allFeatures();
     // from the end to find the latest result with such name
@@ -675,6 +729,90 @@ std::shared_ptr<ModelAPI_Object> Model_Objects::objectByName(
   // not found
   return ObjectPtr();
 }
+#endif
+
+void Model_Objects::nameChanged(const std::wstring& theName, ObjectPtr theObject)
+{
+  if (!myNamesIndexed) // if not indexed, it will be added on the index creation
+    return;
+  std::list<std::weak_ptr<ModelAPI_Object> >& anObjects = myNames[theName];
+  std::list<std::weak_ptr<ModelAPI_Object> >::iterator anObj = anObjects.begin();
+  for(; anObj != anObjects.end(); anObj++) {
+    if (anObj->lock() == theObject)
+      return; // already registered
+  }
+  anObjects.push_back(theObject);
+}
+
+void Model_Objects::nameRemoved(ObjectPtr theObject)
+{
+  if (!myNamesIndexed || !theObject.get() || !theObject->data()->isValid())
+    return;
+  std::unordered_map<std::wstring, std::list<std::weak_ptr<ModelAPI_Object> > >::iterator
+    aFound = myNames.find(theObject->data()->name());
+  if (aFound == myNames.end())
+    return;
+  std::list<std::weak_ptr<ModelAPI_Object> >::iterator anObj = aFound->second.begin();
+  while(anObj != aFound->second.end()) {
+    ObjectPtr anIndexed = anObj->lock();
+    if (!anIndexed.get() || anIndexed == theObject)
+      anObj = aFound->second.erase(anObj);
+    else
+      anObj++;
+  }
+  if (aFound->second.empty())
+    myNames.erase(aFound);
+}
+
+void Model_Objects::featuresByName(const std::wstring& theName, std::list<FeaturePtr>& theFeatures)
+{
+  if (!myNamesIndexed) { // collect names of all features and results
+    std::list<FeaturePtr> allFeats = allFeatures();
+    std::list<FeaturePtr>::iterator aFeat = allFeats.begin();
+    for(; aFeat != allFeats.end(); aFeat++) {
+      myNames[(*aFeat)->data()->name()].push_back(*aFeat);
+      std::list<ResultPtr> allRes;
+      ModelAPI_Tools::allResults(*aFeat, allRes);
+      for(std::list<ResultPtr>::iterator aRes = allRes.begin(); aRes != allRes.end(); aRes++) {
+        if (aRes->get() && (*aRes)->data()->isValid())
+          myNames[(*aRes)->data()->name()].push_back(*aRes);
+      }
+    }
+    myNamesIndexed = true;
+  }
+  std::unordered_map<std::wstring, std::list<std::weak_ptr<ModelAPI_Object> > >::iterator
+    aFound = myNames.find(theName);
+  if (aFound == myNames.end())
+    return;
+  std::map<int, FeaturePtr> anOrdered; // owner features by index in history
+  std::list<std::weak_ptr<ModelAPI_Object> >::iterator anObj = aFound->second.begin();
+  while(anObj != aFound->second.end()) {
+    ObjectPtr anIndexed = anObj->lock();
+    // removed or renamed objects are not needed anymore
+    if (!anIndexed.get() || !anIndexed->data().get() || !anIndexed->data()->isValid() ||
+        anIndexed->data()->name() != theName) {
+      anObj = aFound->second.erase(anObj);
+      continue;
+    }
+    FeaturePtr aFeature = std::dynamic_pointer_cast<ModelAPI_Feature>(anIndexed);
+    if (!aFeature.get()) {
+      ResultPtr aRes = std::dynamic_pointer_cast<ModelAPI_Result>(anIndexed);
+      if (aRes.get())
+        aFeature = feature(aRes);
+    }
+    if (aFeature.get()) {
+      int anIndex = featureIndex(aFeature);
+      if (anIndex >= 0)
+        anOrdered[anIndex] = aFeature;
+    }
+    anObj++;
+  }
+  if (aFound->second.empty())
+    myNames.erase(aFound);
+  std::map<int, FeaturePtr>::reverse_iterator anOrd = anOrdered.rbegin();
+  for(; anOrd != anOrdered.rend(); anOrd++)
+    theFeatures.push_back(anOrd->second);
+}
 
 const int Model_Objects::index(std::shared_ptr<ModelAPI_Object> theObject,
                                const bool theAllowFolder)
@@ -975,6 +1113,21 @@ void Model_Objects::initData(ObjectPtr theObj, TDF_Label theLab, const int theTa
   theObj->initAttributes();
 }
 
+/// Collects objects which have back references to attributes of the given object
+static void collectReferenced(const ObjectPtr& theObject, std::set<ObjectPtr>& theReferenced)
+{
+  std::shared_ptr<Model_Data> aData = std::dynamic_pointer_cast<Model_Data>(theObject->data());
+  if (aData.get() && aData->isValid()) {
+    const Model_Data::RefsFromMe& aRefs = aData->refsFromMe();
+    Model_Data::RefsFromMe::const_iterator aRefIter = aRefs.begin();
+    for(; aRefIter != aRefs.end(); aRefIter++) {
+      ObjectPtr aReferenced = aRefIter->first.lock();
+      if (aReferenced.get())
+        theReferenced.insert(aReferenced);
+    }
+  }
+}
+
 void Model_Objects::synchronizeFeatures(
   const TDF_LabelList& theUpdated, const bool theUpdateReferences,
   const bool theExecuteFeatures, const bool theOpen, const bool theFlush)
@@ -982,6 +1135,10 @@ void Model_Objects::synchronizeFeatures(
   Model_Document* anOwner = std::dynamic_pointer_cast<Model_Document>(myDoc).get();
   if (!anOwner) // this may happen on creation of document: nothing there, so nothing to synchronize
     return;
+  myFeatureIndex.Clear(); // order of features may be changed by undo/redo
+  myFeatureIndexed = false;
+  myNames.clear(); // names are restored by undo/redo without Model_Data::setName
+  myNamesIndexed = false;
   // after all updates, sends a message that groups of features were created or updated
   Events_Loop* aLoop = Events_Loop::loop();
   //static Events_ID aDispEvent = aLoop->eventByName(EVENT_OBJECT_TO_REDISPLAY);
@@ -992,8 +1149,13 @@ void Model_Objects::synchronizeFeatures(
   static Events_ID aToHideEvent = aLoop->eventByName(EVENT_OBJECT_TO_REDISPLAY);
   bool isActive = aLoop->activateFlushes(false);
 
+  // on abort/undo/redo only features and folders modified in the transaction are synchronized
+  const bool isDelta = !theOpen && !theUpdated.IsEmpty();
+
   // collect all updated labels map
   TDF_LabelMap anUpdatedMap;
+  // labels of features and folders touched by the modification, sorted as in the document
+  std::map<int, TDF_Label> aDeltaLabels;
   TDF_ListIteratorOfLabelList anUpdatedIter(theUpdated);
   for(; anUpdatedIter.More(); anUpdatedIter.Next()) {
     TDF_Label& aFeatureLab = anUpdatedIter.Value();
@@ -1001,18 +1163,53 @@ void Model_Objects::synchronizeFeatures(
       aFeatureLab = aFeatureLab.Father();
     if (myFeatures.IsBound(aFeatureLab) || myFolders.IsBound(aFeatureLab))
       anUpdatedMap.Add(aFeatureLab);
+    if (isDelta && aFeatureLab.Father() == featuresLabel())
+      aDeltaLabels[aFeatureLab.Tag()] = aFeatureLab;
+  }
+
+  // modified objects and objects referenced by them before the modification
+  std::set<ObjectPtr> aModified, aReferenced;
+  // labels of the removed features and folders: in delta mode these are only the modified
+  // labels which lost the feature kind, all other objects of the document are kept
+  TDF_LabelList aRemovedLabels;
+  TDF_LabelList aFeatureLabels;
+  if (isDelta) {
+    std::map<int, TDF_Label>::iterator aDeltaIter = aDeltaLabels.begin();
+    for(; aDeltaIter != aDeltaLabels.end(); aDeltaIter++) {
+      const TDF_Label& aLab = aDeltaIter->second;
+      bool isFeature = aLab.IsAttribute(TDataStd_Comment::GetID()) == Standard_True;
+      if (isFeature)
+        aFeatureLabels.Append(aLab);
+      ObjectPtr anObj;
+      FeaturePtr aFeature;
+      if (myFeatures.Find(aLab, aFeature))
+        anObj = aFeature;
+      else
+        myFolders.Find(aLab, anObj);
+      if (!anObj.get())
+        continue;
+      if (!isFeature)
+        aRemovedLabels.Append(aLab);
+      aModified.insert(anObj);
+      collectReferenced(anObj, aReferenced);
+    }
+  } else {
+    TDF_ChildIDIterator aLabIter(featuresLabel(), TDataStd_Comment::GetID());
+    for (; aLabIter.More(); aLabIter.Next())
+      aFeatureLabels.Append(aLabIter.Value()->Label());
   }
 
   // update all objects by checking are they on labels or not
   std::set<ObjectPtr> aNewFeatures, aKeptFeatures;
-  TDF_ChildIDIterator aLabIter(featuresLabel(), TDataStd_Comment::GetID());
+  TDF_ListIteratorOfLabelList aLabIter(aFeatureLabels);
   for (; aLabIter.More(); aLabIter.Next()) {
-    TDF_Label aFeatureLabel = aLabIter.Value()->Label();
+    TDF_Label aFeatureLabel = aLabIter.Value();
     if (!myFeatures.IsBound(aFeatureLabel) && !myFolders.IsBound(aFeatureLabel)) {
       // a new feature or folder is inserted
 
-      std::string aFeatureID = TCollection_AsciiString(Handle(TDataStd_Comment)::DownCast(
-                               aLabIter.Value())->Get()).ToCString();
+      Handle(TDataStd_Comment) aKind;
+      aFeatureLabel.FindAttribute(TDataStd_Comment::GetID(), aKind);
+      std::string aFeatureID = TCollection_AsciiString(aKind->Get()).ToCString();
       bool isFolder = aFeatureID == ModelAPI_Folder::ID();
 
       std::shared_ptr<Model_Session> aSession =
@@ -1024,7 +1221,7 @@ void Model_Objects::synchronizeFeatures(
       if (!aFeature.get()) {
         // something is wrong, most probably, the opened document has invalid structure
         Events_InfoMessage("Model_Objects", "Invalid type of object in the document").send();
-        aLabIter.Value()->Label().ForgetAllAttributes();
+        aFeatureLabel.ForgetAllAttributes();
         continue;
       }
       aFeature->init();
@@ -1034,6 +1231,7 @@ void Model_Objects::synchronizeFeatures(
       else
         myFeatures.Bind(aFeatureLabel, std::dynamic_pointer_cast<ModelAPI_Feature>(aFeature));
       aNewFeatures.insert(aFeature);
+      aModified.insert(aFeature);
       initData(aFeature, aFeatureLabel, TAG_FEATURE_ARGUMENTS);
       updateHistory(aFeature);
 
@@ -1091,70 +1289,126 @@ void Model_Objects::synchronizeFeatures(
   }
 
   // check all features are checked: if not => it was removed
-  NCollection_DataMap<TDF_Label, FeaturePtr>::Iterator aFIter(myFeatures);
-  while (aFIter.More()) {
-    if (aKeptFeatures.find(aFIter.Value()) == aKeptFeatures.end()
-      && aNewFeatures.find(aFIter.Value()) == aNewFeatures.end()) {
-        FeaturePtr aFeature = aFIter.Value();
-        // event: model is updated
-        //if (aFeature->isInHistory()) {
-        ModelAPI_EventCreator::get()->sendDeleted(myDoc, ModelAPI_Feature::group());
-        //}
-        // results of this feature must be redisplayed (hided)
-        // redisplay also removed feature (used for sketch and AISObject)
-        ModelAPI_EventCreator::get()->sendUpdated(aFeature, aRedispEvent);
-        updateHistory(aFeature);
-        aFeature->erase();
-
-        // unbind after the "erase" call: on abort sketch
-        // is removes sub-objects that corrupts aFIter
-        myFeatures.UnBind(aFIter.Key());
-        // reinitialize iterator because unbind may corrupt the previous order in the map
-        aFIter.Initialize(myFeatures);
-    } else
-      aFIter.Next();
-  }
-  // verify folders are checked: if not => is was removed
-  for (NCollection_DataMap<TDF_Label, ObjectPtr>::Iterator aFldIt(myFolders);
-       aFldIt.More(); aFldIt.Next()) {
-    ObjectPtr aCurObj = aFldIt.Value();
-    if (aKeptFeatures.find(aCurObj) == aKeptFeatures.end() &&
-        aNewFeatures.find(aCurObj) == aNewFeatures.end()) {
+  if (!isDelta) {
+    NCollection_DataMap<TDF_Label, FeaturePtr>::Iterator aFIter(myFeatures);
+    for (; aFIter.More(); aFIter.Next()) {
+      if (aKeptFeatures.find(aFIter.Value()) == aKeptFeatures.end()
+        && aNewFeatures.find(aFIter.Value()) == aNewFeatures.end())
+        aRemovedLabels.Append(aFIter.Key());
+    }
+    // verify folders are checked: if not => is was removed
+    NCollection_DataMap<TDF_Label, ObjectPtr>::Iterator aFldIt(myFolders);
+    for (; aFldIt.More(); aFldIt.Next()) {
+      if (aKeptFeatures.find(aFldIt.Value()) == aKeptFeatures.end() &&
+          aNewFeatures.find(aFldIt.Value()) == aNewFeatures.end())
+        aRemovedLabels.Append(aFldIt.Key());
+    }
+  }
+  for(TDF_ListIteratorOfLabelList aRemIter(aRemovedLabels); aRemIter.More(); aRemIter.Next()) {
+    FeaturePtr aFeature;
+    ObjectPtr aCurObj;
+    // erase of a feature may remove other objects (sub-features of the aborted sketch)
+    if (myFeatures.Find(aRemIter.Value(), aFeature)) {
+      // event: model is updated
+      //if (aFeature->isInHistory()) {
+      ModelAPI_EventCreator::get()->sendDeleted(myDoc, ModelAPI_Feature::group());
+      //}
+      // results of this feature must be redisplayed (hided)
+      // redisplay also removed feature (used for sketch and AISObject)
+      ModelAPI_EventCreator::get()->sendUpdated(aFeature, aRedispEvent);
+      updateHistory(aFeature);
+      aModified.insert(aFeature);
+      collectReferenced(aFeature, aReferenced);
+      aFeature->erase();
+      // unbind after the "erase" call: on abort sketch is removes sub-objects
+      myFeatures.UnBind(aRemIter.Value());
+    } else if (myFolders.Find(aRemIter.Value(), aCurObj)) {
       ModelAPI_EventCreator::get()->sendDeleted(myDoc, ModelAPI_Folder::group());
       // results of this feature must be redisplayed (hided)
       // redisplay also removed feature (used for sketch and AISObject)
       ModelAPI_EventCreator::get()->sendUpdated(aCurObj, aRedispEvent);
       updateHistory(aCurObj);
+      aModified.insert(aCurObj);
+      collectReferenced(aCurObj, aReferenced);
       aCurObj->erase();
-
-      // unbind after the "erase" call: on abort sketch
-      // is removes sub-objects that corrupts aFIter
-      myFolders.UnBind(aFldIt.Key());
-      // reinitialize iterator because unbind may corrupt the previous order in the map
-      aFldIt.Initialize(myFolders);
+      myFolders.UnBind(aRemIter.Value());
     }
   }
 
+  // back references are kept up to date by the referencing attributes, so only the created,
+  // modified and removed objects are synchronized; on open everything is collected. New objects
+  // among the kept ones may be referenced by the kept objects: collect everything then too.
+  bool isAllRefs = theOpen || (!isDelta && !aNewFeatures.empty() && !aKeptFeatures.empty());
   if (theUpdateReferences) {
-    synchronizeBackRefs();
+    if (theOpen) {
+      // the index is built once, when the results are created; before it only sub-features
+      // of composites need the back reference to the owner (sketch for the sub-elements)
+      std::set<ObjectPtr> aComposites;
+      NCollection_DataMap<TDF_Label, FeaturePtr>::Iterator aFIter(myFeatures);
+      for(; aFIter.More(); aFIter.Next()) {
+        if (std::dynamic_pointer_cast<ModelAPI_CompositeFeature>(aFIter.Value()).get())
+          aComposites.insert(aFIter.Value());
+      }
+      synchronizeBackRefs(aComposites, std::set<ObjectPtr>());
+    } else if (isAllRefs)
+      synchronizeBackRefs();
+    else
+      synchronizeBackRefs(aModified, aReferenced);
+  }
+  // results of the kept features: a result appeared on undo/redo may be referenced by
+  // not modified features, so back references of the whole document are needed then
+  std::set<ResultPtr> aKeptResults;
+  if (!isAllRefs && theUpdateReferences) {
+    for(aLabIter.Init(aFeatureLabels); aLabIter.More(); aLabIter.Next()) {
+      FeaturePtr aFeature;
+      if (myFeatures.Find(aLabIter.Value(), aFeature) &&
+          aNewFeatures.find(aFeature) == aNewFeatures.end()) {
+        std::list<ResultPtr> aResults;
+        ModelAPI_Tools::allResults(aFeature, aResults);
+        aKeptResults.insert(aResults.begin(), aResults.end());
+      }
+    }
   }
   // update results of the features (after features created because
   // they may be connected, like sketch and sub elements)
   // After synchronization of back references because sketch
   // must be set in sub-elements before "execute" by updateResults
   std::set<FeaturePtr> aProcessed; // composites must be updated after their subs (issue 360)
-  TDF_ChildIDIterator aLabIter2(featuresLabel(), TDataStd_Comment::GetID());
-  for (; aLabIter2.More(); aLabIter2.Next()) {
-    TDF_Label aFeatureLabel = aLabIter2.Value()->Label();
-    if (myFeatures.IsBound(aFeatureLabel)) {  // a new feature is inserted
-      FeaturePtr aFeature = myFeatures.Find(aFeatureLabel);
+  if (!isDelta) {
+    aFeatureLabels.Clear();
+    TDF_ChildIDIterator aLabIter2(featuresLabel(), TDataStd_Comment::GetID());
+    for (; aLabIter2.More(); aLabIter2.Next())
+      aFeatureLabels.Append(aLabIter2.Value()->Label());
+  }
+  for(aLabIter.Init(aFeatureLabels); aLabIter.More(); aLabIter.Next()) {
+    FeaturePtr aFeature;
+    if (myFeatures.Find(aLabIter.Value(), aFeature)) {
       updateResults(aFeature, aProcessed);
+      // features created by the current operation (paste) are referenced only by the
+      // modified features
+      if (!isAllRefs && theUpdateReferences &&
+          aNewFeatures.find(aFeature) == aNewFeatures.end() &&
+          myCreatedFeatures.find(aFeature) == myCreatedFeatures.end()) {
+        std::list<ResultPtr> aResults;
+        ModelAPI_Tools::allResults(aFeature, aResults);
+        std::list<ResultPtr>::iterator aRes = aResults.begin();
+        for(; aRes != aResults.end() && !isAllRefs; aRes++)
+          isAllRefs = aKeptResults.find(*aRes) == aKeptResults.end();
+      }
     }
   }
   // the synchronize should be done after updateResults
   // in order to correct back references of updated results
   if (theUpdateReferences) {
-    synchronizeBackRefs();
+    if (isAllRefs)
+      synchronizeBackRefs();
+    else
+      synchronizeBackRefs(aModified, aReferenced);
+    if (isAllRefs) { // everything is synchronized
+      myChangedRefs.clear();
+      myChangedReferenced.clear();
+      myIsAllBackRefs = false;
+    }
   }
   if (!theUpdated.IsEmpty()) {
     // this means there is no control what was modified => remove history cash
@@ -1309,6 +1563,7 @@ void Model_Objects::synchronizeBackRefs()
     collectReferences(aFolder->data(), allRefs);
   }
   // second iteration: just compare back-references with existing in features and results
+  std::list<ResultPtr> anAllResults; // to update the concealment status in the end
   for(aFeatures.Initialize(myFeatures); aFeatures.More(); aFeatures.Next()) {
     FeaturePtr aFeature = aFeatures.Value();
     static std::set<AttributePtr> anEmpty;
@@ -1332,16 +1587,12 @@ void Model_Objects::synchronizeBackRefs()
         allRefs.erase(aFound); // to check that all refs are counted
       }
     }
+    anAllResults.splice(anAllResults.end(), aResults);
   }
-  for(aFeatures.Initialize(myFeatures); aFeatures.More(); aFeatures.Next()) {
-    FeaturePtr aFeature = aFeatures.Value();
-    std::list<ResultPtr> aResults;
-    ModelAPI_Tools::allResults(aFeature, aResults);
-    // update the concealment status for display in isConcealed of ResultBody
-    std::list<ResultPtr>::iterator aRIter = aResults.begin();
-    for(; aRIter != aResults.cend(); aRIter++) {
-      (*aRIter)->isConcealed();
-    }
+  // update the concealment status for display in isConcealed of ResultBody
+  std::list<ResultPtr>::iterator aRIter = anAllResults.begin();
+  for(; aRIter != anAllResults.cend(); aRIter++) {
+    (*aRIter)->isConcealed();
   }
   // the rest all refs means that feature references to the external document feature:
   // process also them
@@ -1351,6 +1602,84 @@ void Model_Objects::synchronizeBackRefs()
   }
 }
 
+void Model_Objects::backReferenceChanged(const ObjectPtr& theOwner,
+                                         const ObjectPtr& theReferenced)
+{
+  myChangedRefs.insert(theOwner);
+  myChangedReferenced.insert(theReferenced);
+}
+
+void Model_Objects::synchronizeChangedBackRefs()
+{
+  // the synchronization itself changes back references: take the collected ones before
+  std::set<ObjectPtr> aModified, aReferenced;
+  aModified.swap(myChangedRefs);
+  aReferenced.swap(myChangedReferenced);
+  if (myIsAllBackRefs) {
+    myIsAllBackRefs = false;
+    synchronizeBackRefs();
+  } else if (!aModified.empty()) {
+    synchronizeBackRefs(aModified, aReferenced);
+  }
+  myChangedRefs.clear();
+  myChangedReferenced.clear();
+}
+
+void Model_Objects::synchronizeBackRefs(const std::set<ObjectPtr>& theModified,
+                                        const std::set<ObjectPtr>& theReferenced)
+{
+  // back references may be changed only in the modified objects, in their results and
+  // in objects referenced by them before or after the modification
+  std::map<ObjectPtr, std::set<AttributePtr> > aModifiedRefs;
+  std::set<ObjectPtr> aTargets(theReferenced);
+  std::set<ObjectPtr>::const_iterator aModIter = theModified.cbegin();
+  for(; aModIter != theModified.cend(); aModIter++) {
+    if (!(*aModIter)->data()->isValid())
+      continue; // removed
+    collectReferences((*aModIter)->data(), aModifiedRefs);
+    aTargets.insert(*aModIter);
+    FeaturePtr aFeature = std::dynamic_pointer_cast<ModelAPI_Feature>(*aModIter);
+    if (aFeature.get()) {
+      std::list<ResultPtr> aResults;
+      ModelAPI_Tools::allResults(aFeature, aResults);
+      aTargets.insert(aResults.begin(), aResults.end());
+    }
+  }
+  std::map<ObjectPtr, std::set<AttributePtr> >::iterator aRefsIter = aModifiedRefs.begin();
+  for(; aRefsIter != aModifiedRefs.end(); aRefsIter++)
+    aTargets.insert(aRefsIter->first);
+
+  std::list<ResultPtr> aResults; // to update the concealment status in the end
+  std::set<ObjectPtr>::iterator aTarget = aTargets.begin();
+  for(; aTarget != aTargets.end(); aTarget++) {
+    if (!aTarget->get() || !(*aTarget)->data()->isValid())
+      continue;
+    // references from not modified objects are kept as they are
+    std::set<AttributePtr> aNewRefs;
+    const std::set<AttributePtr>& aCurrent = (*aTarget)->data()->refsToMe();
+    std::set<AttributePtr>::const_iterator aRef = aCurrent.cbegin();
+    for(; aRef != aCurrent.cend(); aRef++) {
+      ObjectPtr anOwner = (*aRef)->owner();
+      if (anOwner.get() && anOwner->data()->isValid() &&
+          theModified.find(anOwner) == theModified.end())
+        aNewRefs.insert(*aRef);
+    }
+    aRefsIter = aModifiedRefs.find(*aTarget);
+    if (aRefsIter != aModifiedRefs.end())
+      aNewRefs.insert(aRefsIter->second.begin(), aRefsIter->second.end());
+    synchronizeBackRefsForObject(aNewRefs, *aTarget);
+
+    ResultPtr aRes = std::dynamic_pointer_cast<ModelAPI_Result>(*aTarget);
+    if (aRes.get() && aRes->document() == myDoc)
+      aResults.push_back(aRes);
+  }
+  // update the concealment status for display in isConcealed of ResultBody
+  std::list<ResultPtr>::iterator aRIter = aResults.begin();
+  for(; aRIter != aResults.cend(); aRIter++) {
+    (*aRIter)->isConcealed();
+  }
+}
+
 TDF_Label Model_Objects::resultLabel(
   const std::shared_ptr<ModelAPI_Data>& theFeatureData, const int theResultIndex)
 {
@@ -1404,6 +1733,9 @@ void Model_Objects::storeResult(std::shared_ptr<ModelAPI_Data> theFeatureData,
   theResult->init();
   theResult->setDoc(myDoc);
   initData(theResult, resultLabel(theFeatureData, theResultIndex), TAG_FEATURE_ARGUMENTS);
+  // a result of the existing feature may be referenced by label from any later feature
+  if (myCreatedFeatures.find(theFeatureData->owner()) == myCreatedFeatures.end())
+    myIsAllBackRefs = true;
   if (theResult->data()->name().empty()) {
     // if was not initialized, generate event and set a name
     std::wstring aNewName = theFeatureData->name();
@@ -1426,6 +1758,8 @@ void Model_Objects::storeResult(std::shared_ptr<ModelAPI_Data> theFeatureData,
     }
     theResult->data()->setName(aNewName);
   }
+  // a result recreated on the label keeps the stored name, so, setName is not called for it
+  nameChanged(theResult->data()->name(), theResult);
 }
 
 std::shared_ptr<ModelAPI_ResultConstruction> Model_Objects::createConstruction(
@@ -1565,7 +1899,9 @@ std::shared_ptr<ModelAPI_Folder> Model_Objects::createFolder(
     if (aFeaturesLab.FindAttribute(TDataStd_ReferenceArray::GetID(), aRefs))
       aPrevFeatureLab = aRefs->Value(aRefs->Upper());
   }
+  int aChangedFrom = featureIndex(aPrevFeatureLab) + 1;
   AddToRefArray(aFeaturesLab, aFolderLab, aPrevFeatureLab);
+  updateFeatureIndex(aChangedFrom);
 
   // keep the feature ID to restore document later correctly
   TDataStd_Comment::Set(aFolderLab, ModelAPI_Folder::ID().c_str());
@@ -1605,7 +1941,9 @@ void Model_Objects::removeFolder(std::shared_ptr<ModelAPI_Folder> theFolder)
   // erase all attributes under the label of feature
   aFolderLabel.ForgetAllAttributes();
   // remove it from the references array
-  RemoveFromRefArray(featuresLabel(), aFolderLabel);
+  int aChangedFrom = RemoveFromRefArray(featuresLabel(), aFolderLabel);
+  myFeatureIndex.UnBind(aFolderLabel);
+  updateFeatureIndex(aChangedFrom);
   // event: feature is deleted
   ModelAPI_EventCreator::get()->sendDeleted(theFolder->document(), ModelAPI_Folder::group());
   updateHistory(ModelAPI_Folder::group());
@@ -1796,8 +2134,10 @@ bool Model_Objects::moveToFolder(
       }
 
     // move the folder in the list of references before the first feature
+    int aChangedFrom = Min(featureIndex(aFolderLabel), featureIndex(aPrevFeatureLabel) + 1);
     RemoveFromRefArray(aFeaturesLab, aFolderLabel);
     AddToRefArray(aFeaturesLab, aFolderLabel, aPrevFeatureLabel);
+    updateFeatureIndex(aChangedFrom);
     // update first feature of the folder
     initFirstAttr = true;
   } else {
@@ -1891,8 +2231,10 @@ bool Model_Objects::removeFromFolder(
       aFolderStartFeature = aNewStartFeature;
     }
     // move the folder in the list of references after the last feature from the list
+    int aChangedFrom = Min(featureIndex(aFolderLabel), featureIndex(aPrevFeatureLabel) + 1);
     RemoveFromRefArray(aFeaturesLab, aFolderLabel);
     AddToRefArray(aFeaturesLab, aFolderLabel, aPrevFeatureLabel);
+    updateFeatureIndex(aChangedFrom);
   } else {
     // update end reference of the folder
     if (aFolderEndFeature.get()) {
@@ -2120,6 +2462,50 @@ void Model_Objects::updateResults(FeaturePtr theFeature, std::set<FeaturePtr>& t
 }
 
 ResultPtr Model_Objects::findByName(const std::wstring theName)
+{
+  ResultPtr aResult;
+  FeaturePtr aResFeature; // keep feature to return the latest one
+  std::list<FeaturePtr> aFeatures;
+  featuresByName(theName, aFeatures);
+  std::list<FeaturePtr>::iterator anObjIter = aFeatures.begin();
+  for(; anObjIter != aFeatures.end(); anObjIter++) {
+    FeaturePtr& aFeature = *anObjIter;
+    if (!aFeature.get() || aFeature->isDisabled()) // may be on close
+      continue;
+    std::list<ResultPtr> allResults;
+    ModelAPI_Tools::allResults(aFeature, allResults);
+    std::list<ResultPtr>::iterator aRIter = allResults.begin();
+    for (; aRIter != allResults.cend(); aRIter++) {
+      ResultPtr aRes = *aRIter;
+      if (aRes.get() && aRes->data() && aRes->data()->isValid() && !aRes->isDisabled() &&
+          aRes->data()->name() == theName)
+      {
+        bool isCurGroup = std::dynamic_pointer_cast<ModelAPI_ResultGroup>(aRes).get() != nullptr;
+        bool isResGroup = std::dynamic_pointer_cast<ModelAPI_ResultGroup>(aResult).get() != nullptr;
+
+        if(aResult.get() && !isResGroup && isCurGroup)
+          continue; // skip group if there is alreay non group result
+
+        // select rather non-group result than group OR the latest
+        if (!aResult.get() || isLater(aFeature, aResFeature) || (isResGroup && !isCurGroup)) {
+          aResult = aRes;
+          aResFeature = aFeature;
+        }
+      }
+    }
+  }
+#ifdef DEBUG_NAMES_INDEX
+  ResultPtr aScanned = findByNameScan(theName);
+  if (aResult != aScanned) { // the linear search is the reference
+    Events_InfoMessage("Model_Objects", "Names index error: result '%1'").arg(theName).send();
+    aResult = aScanned;
+  }
+#endif
+  return aResult;
+}
+
+#ifdef DEBUG_NAMES_INDEX
+ResultPtr Model_Objects::findByNameScan(const std::wstring& theName)
 {
   ResultPtr aResult;
   FeaturePtr aResFeature; // keep feature to return the latest one
@@ -2152,6 +2538,7 @@ ResultPtr Model_Objects::findByName(const std::wstring theName)
   }
   return aResult;
 }
+#endif
 
 TDF_Label Model_Objects::nextLabel(TDF_Label theCurrent, int& theIndex, const bool theReverse)
 {
@@ -2216,30 +2603,59 @@ FeaturePtr Model_Objects::lastFeature()
   return FeaturePtr(); // no features at all
 }
 
+int Model_Objects::featureIndex(const TDF_Label& theLabel) const
+{
+  Handle(TDataStd_ReferenceArray) aRefs;
+  if (!featuresLabel().FindAttribute(TDataStd_ReferenceArray::GetID(), aRefs))
+    return -1;
+  const int* aFound = myFeatureIndexed ? myFeatureIndex.Seek(theLabel) : NULL;
+  // the position is checked in the array: if the array was changed bypassing the index
+  // (or the label is not indexed yet), the index is computed again
+  if (aFound && *aFound >= aRefs->Lower() && *aFound <= aRefs->Upper() &&
+      aRefs->Value(*aFound) == theLabel)
+    return *aFound;
+  if (myFeatureIndexed && !aFound)
+    return -1;
+  myFeatureIndex.Clear();
+  for(int a = aRefs->Lower(); a <= aRefs->Upper(); a++) { // iterate all existing features
+    myFeatureIndex.Bind(aRefs->Value(a), a);
+  }
+  myFeatureIndexed = true;
+  aFound = myFeatureIndex.Seek(theLabel);
+  return aFound ? *aFound : -1;
+}
+
+void Model_Objects::updateFeatureIndex(const int theFrom)
+{
+  if (!myFeatureIndexed)
+    return; // will be computed on demand
+  Handle(TDataStd_ReferenceArray) aRefs;
+  if (!featuresLabel().FindAttribute(TDataStd_ReferenceArray::GetID(), aRefs)) {
+    myFeatureIndex.Clear();
+    return;
+  }
+  // Bind replaces the position of the labels already in the map
+  for(int a = Max(theFrom, aRefs->Lower()); a <= aRefs->Upper(); a++) {
+    myFeatureIndex.Bind(aRefs->Value(a), a);
+  }
+}
+
+int Model_Objects::featureIndex(FeaturePtr theFeature) const
+{
+  std::shared_ptr<Model_Data> aData = std::static_pointer_cast<Model_Data>(theFeature->data());
+  if (aData.get() && aData->isValid())
+    return featureIndex(aData->label().Father());
+  return -1;
+}
+
 bool Model_Objects::isLater(FeaturePtr theLater, FeaturePtr theCurrent) const
 {
   if (theLater->getKind() == "InternalSelectionInPartFeature" || theLater->getKind() == "InternalSelectionInResult")
     return true;
-  std::shared_ptr<Model_Data> aLaterD = std::static_pointer_cast<Model_Data>(theLater->data());
-  std::shared_ptr<Model_Data> aCurrentD = std::static_pointer_cast<Model_Data>(theCurrent->data());
-  if (aLaterD.get() && aLaterD->isValid() && aCurrentD.get() && aCurrentD->isValid()) {
-    TDF_Label aLaterL = aLaterD->label().Father();
-    TDF_Label aCurrentL = aCurrentD->label().Father();
-    int aLaterI = -1, aCurentI = -1; // not found yet state
-    Handle(TDataStd_ReferenceArray) aRefs;
-    if (featuresLabel().FindAttribute(TDataStd_ReferenceArray::GetID(), aRefs)) {
-      for(int a = aRefs->Lower(); a <= aRefs->Upper(); a++) { // iterate all existing features
-        TDF_Label aCurLab = aRefs->Value(a);
-        if (aCurLab.IsEqual(aLaterL)) {
-          aLaterI = a;
-        } else if (aCurLab.IsEqual(aCurrentL)) {
-          aCurentI = a;
-        } else continue;
-        if (aLaterI != -1 && aCurentI != -1) // both are found
-          return aLaterI > aCurentI;
-      }
-    }
-  }
+  int aLaterI = featureIndex(theLater);
+  int aCurrentI = featureIndex(theCurrent);
+  if (aLaterI != -1 && aCurrentI != -1 && aLaterI != aCurrentI)
+    return aLaterI > aCurrentI;
   return false; // not found, or something is wrong
 }
 
@@ -32,8 +32,13 @@
 #include <TDF_LabelList.hxx>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
+// uncomment to check the results of search by names index by the linear search:
+// a difference is reported as an error message and the result of linear search is returned
+//#define DEBUG_NAMES_INDEX
+
 extern int kUNDEFINED_FEATURE_INDEX;
 
 /**\class Model_Objects
@@ -84,6 +89,16 @@ class Model_Objects
   //! Returns the result by the result name
   ResultPtr findByName(const std::wstring theName);
 
+  //! Registers the new name of the object in the index of names
+  void nameChanged(const std::wstring& theName, ObjectPtr theObject);
+
+  //! Removes the object from the index of names (on erase of the object)
+  void nameRemoved(ObjectPtr theObject);
+
+  //! Registers that a back reference from theOwner to theReferenced was added or removed:
+  //! back references of them are synchronized with the attributes in the end of the operation
+  void backReferenceChanged(const ObjectPtr& theOwner, const ObjectPtr& theReferenced);
+
 
   //! Returns the object index in the group. Object must be visible. Otherwise returns -1.
   //! \param theObject object of this document
@@ -244,6 +259,16 @@ class Model_Objects
     const bool theOpen, const bool theExecuteFeatures, const bool theFlush);
   //! Synchronizes the BackReferences list in Data of Features and Results
   void synchronizeBackRefs();
+  //! Synchronizes the BackReferences list only for the given modified features and folders,
+  //! their results and objects referenced by them
+  //! \param theModified features and folders created, modified or removed
+  //! \param theReferenced objects referenced by theModified before the modification
+  void synchronizeBackRefs(const std::set<ObjectPtr>& theModified,
+                           const std::set<ObjectPtr>& theReferenced);
+  //! Synchronizes the BackReferences list only for objects which references were changed
+  //! since the last synchronization, or of the whole document if a new result appeared
+  //! in a feature created before (it may be referenced by any later feature)
+  void synchronizeChangedBackRefs();
 
   //! Creates manager on the OCAF document main label
   Model_Objects(TDF_Label theMainLab);
@@ -290,6 +315,16 @@ class Model_Objects
   /// Returns true if theLater is in history of features creation later than theCurrent
   bool isLater(FeaturePtr theLater, FeaturePtr theCurrent) const;
 
+  /// Returns position of the feature in the history of features creation, or -1 if not found
+  int featureIndex(FeaturePtr theFeature) const;
+
+  /// Returns position of the feature (or folder) label in the features array, or -1
+  int featureIndex(const TDF_Label& theLabel) const;
+
+  /// Updates the positions of the features array labels starting from theFrom after
+  /// the array was changed there (if the positions were already computed)
+  void updateFeatureIndex(const int theFrom);
+
   /// Returns the next or previous label
   /// \param theCurrent given label
   /// \param theReverse if it is true, iterates in reversed order (next becomes previous)
@@ -324,6 +359,17 @@ class Model_Objects
   /// Return object representing a folder or empty pointer
   const ObjectPtr& folder(TDF_Label theLabel) const;
 
+  /// Returns features that own objects with the given name (features and results),
+  /// ordered from the latest to the first in the history
+  void featuresByName(const std::wstring& theName, std::list<FeaturePtr>& theFeatures);
+
+#ifdef DEBUG_NAMES_INDEX
+  /// Linear search of object by name, to check the index
+  ObjectPtr objectByNameScan(const std::string& theGroupID, const std::wstring& theName);
+  /// Linear search of result by name, to check the index
+  ResultPtr findByNameScan(const std::wstring& theName);
+#endif
+
  private:
   TDF_Label myMain; ///< main label of the data storage
 
@@ -336,6 +382,27 @@ class Model_Objects
   /// Managed folders
   NCollection_DataMap<TDF_Label, ObjectPtr> myFolders;
 
+  /// Positions of the labels in the features array, to compare the features order fast.
+  /// Computed by demand, then updated on each change of the array (reset by undo/redo).
+  mutable NCollection_DataMap<TDF_Label, int> myFeatureIndex;
+  /// True if myFeatureIndex contains all labels of the features array
+  mutable bool myFeatureIndexed;
+
+  /// Map from name to objects that had this name: candidates for the search by name.
+  /// Erased objects are removed at once, renamed ones on search; the whole index is reset
+  /// on undo/redo. Objects are not kept alive by the index.
+  std::unordered_map<std::wstring, std::list<std::weak_ptr<ModelAPI_Object> > > myNames;
+  /// True if myNames contains all the objects of the document
+  bool myNamesIndexed;
+
+  /// Objects which back references were changed by the attributes since the last
+  /// synchronization, and the objects referenced by them
+  std::set<ObjectPtr> myChangedRefs, myChangedReferenced;
+  /// Features created in the current operation: their new results are not referenced yet
+  std::set<ObjectPtr> myCreatedFeatures;
+  /// True if a new result appeared in a feature created before the current operation
+  bool myIsAllBackRefs;
+
   /// Map from group id to the array that contains all objects located in history.
   /// Each array is updated by demand from scratch, by browsing all the features in the history.
   std::map<std::string, std::vector<ObjectPtr> > myHistory;
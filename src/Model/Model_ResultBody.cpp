@@ -398,6 +398,14 @@ void Model_ResultBody::setShapeName(
   myColorsShape = theColorsShape;
 }
 
+void Model_ResultBody::getShapeName(
+                std::map< std::wstring, std::shared_ptr<GeomAPI_Shape>>& theShapeName,
+                std::map< std::wstring, std::vector<int>>& theColorsShape)
+{
+  theShapeName = myNamesOfShapes;
+  theColorsShape = myColorsShape;
+}
+
 void Model_ResultBody::clearShapeNameAndColor(){
   myNamesOfShapes.clear();
   myColorsShape.clear();
@@ -179,6 +179,10 @@ protected:
   void setShapeName(std::map<std::wstring, std::shared_ptr<GeomAPI_Shape>>& theShapeName,
                     std::map<std::wstring, std::vector<int>>& theColorsShape) override;
 
+  /// Get the map of name and color read shape in step file
+  void getShapeName(std::map<std::wstring, std::shared_ptr<GeomAPI_Shape>>& theShapeName,
+                    std::map<std::wstring, std::vector<int>>& theColorsShape) override;
+
   /// Return Attribute selection
   MODELAPI_EXPORT virtual std::shared_ptr<ModelAPI_AttributeSelection> selection();
 
@@ -40,6 +40,9 @@
 #include <ModelAPI_ResultPart.h>
 #include <ModelAPI_Tools.h>
 
+#include <GeomAlgoAPI_PaveFillerCache.h>
+#include <GeomAlgoAPI_Tools.h>
+
 #include <TDF_ChildIDIterator.hxx>
 #include <TDF_CopyTool.hxx>
 #include <TDF_DataSet.hxx>
@@ -74,6 +77,10 @@ bool Model_Session::save(const char* theFileName, std::list<std::string>& theRes
 void Model_Session::closeAll()
 {
   Model_Application::getApplication()->deleteAllDocuments();
+  // intersections of the shapes of closed documents are not needed anymore
+  GeomAlgoAPI_PaveFillerCache::clear();
+  // as well as the translated files imported into them
+  GeomAlgoAPI_Tools::Import_Tools::clearCache();
   static const Events_ID aDocsCloseEvent = Events_Loop::eventByName(EVENT_DOCUMENTS_CLOSED);
   myCurrentDoc = NULL;
   static std::shared_ptr<Events_Message> aMsg(new Events_Message(aDocsCloseEvent));
@@ -455,6 +462,8 @@ Model_Session::Model_Session()
 {
   myPluginsInfoLoaded = false;
   myCheckTransactions = true;
+  myIsParallelRebuild = false;
+  myParallelPrepared = 0;
   myIsLoading = false;
   ModelAPI_Session::setSession(std::shared_ptr<ModelAPI_Session>(this));
   // register the configuration reading listener
@@ -467,6 +476,13 @@ Model_Session::Model_Session()
   aLoop->registerListener(this, Events_Loop::eventByName(EVENT_OBJECT_DELETED), 0, true);
   aLoop->registerListener(this, Events_Loop::eventByName(EVENT_VALIDATOR_LOADED));
   aLoop->registerListener(this, Events_Loop::eventByName(Config_PluginMessage::EVENT_ID()));
+  // created objects must be known before update, updated before redisplay, deleted - at the end
+  std::list<Events_ID> aFlushOrder;
+  aFlushOrder.push_back(Events_Loop::eventByName(EVENT_OBJECT_CREATED));
+  aFlushOrder.push_back(Events_Loop::eventByName(EVENT_OBJECT_UPDATED));
+  aFlushOrder.push_back(Events_Loop::eventByName(EVENT_OBJECT_TO_REDISPLAY));
+  aFlushOrder.push_back(Events_Loop::eventByName(EVENT_OBJECT_DELETED));
+  aLoop->setFlushOrder(aFlushOrder);
 }
 
 void Model_Session::processEvent(const std::shared_ptr<Events_Message>& theMessage)
@@ -683,6 +699,37 @@ void Model_Session::blockAutoUpdate(const bool theBlock)
   }
 }
 
+bool Model_Session::isParallelRebuild()
+{
+  return myIsParallelRebuild;
+}
+
+void Model_Session::setParallelRebuild(const bool theParallel)
+{
+  myIsParallelRebuild = theParallel;
+}
+
+int Model_Session::parallelPreparedNumber()
+{
+  return myParallelPrepared;
+}
+
+void Model_Session::addParallelPrepared(const int theNumber)
+{
+  myParallelPrepared += theNumber;
+}
+
+bool Model_Session::isParallelBooleans()
+{
+  return GeomAlgoAPI_Tools::BOP_Policy::isParallel();
+}
+
+void Model_Session::setParallelBooleans(const bool theParallel, const int theNbThreads)
+{
+  GeomAlgoAPI_Tools::BOP_Policy::setParallel(theParallel);
+  GeomAlgoAPI_Tools::BOP_Policy::setThreadsNumber(theNbThreads);
+}
+
 #ifdef TINSPECTOR
 Handle(TDocStd_Application) Model_Session::application()
 {
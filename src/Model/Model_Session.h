@@ -52,6 +52,10 @@ class Model_Session : public ModelAPI_Session, public Events_Listener
 
   /// if true, generates error if document is updated outside of transaction
   bool myCheckTransactions;
+  /// if true, independent features are prepared for execution concurrently
+  bool myIsParallelRebuild;
+  /// number of features prepared concurrently since the session start
+  int myParallelPrepared;
   /// if true, the current operation must be committed twice,
   /// with nested (list for any nesting depth)
   std::list<bool> myOperationAttachedToNext;
@@ -164,6 +168,25 @@ class Model_Session : public ModelAPI_Session, public Events_Listener
   /// Set state of the auto-update of features result in the application
   MODEL_EXPORT virtual void blockAutoUpdate(const bool theBlock);
 
+  /// Returns true if independent features are prepared for execution concurrently on rebuild
+  MODEL_EXPORT virtual bool isParallelRebuild();
+
+  /// Enables or disables the parallel preparation of independent features on rebuild
+  MODEL_EXPORT virtual void setParallelRebuild(const bool theParallel);
+
+  /// Returns the number of features prepared concurrently since the session start
+  MODEL_EXPORT virtual int parallelPreparedNumber();
+
+  /// Counts theNumber of features prepared concurrently by the update of the model
+  void addParallelPrepared(const int theNumber);
+
+  /// Returns true if boolean operations run in parallel
+  MODEL_EXPORT virtual bool isParallelBooleans();
+
+  /// Enables or disables the parallel mode of boolean operations using theNbThreads threads
+  MODEL_EXPORT virtual void setParallelBooleans(const bool theParallel,
+                                                const int theNbThreads = 0);
+
 #ifdef TINSPECTOR
   MODEL_EXPORT virtual Handle(TDocStd_Application) application();
 #endif
@@ -21,6 +21,7 @@
 #include <Model_Document.h>
 #include <Model_Data.h>
 #include <Model_Objects.h>
+#include <Model_Session.h>
 #include <ModelAPI_Feature.h>
 #include <ModelAPI_Data.h>
 #include <ModelAPI_Document.h>
@@ -48,6 +49,12 @@
 #include <Events_InfoMessage.h>
 #include <Config_PropManager.h>
 
+#include <OSD_Parallel.hxx>
+#include <Standard_Failure.hxx>
+
+#include <exception>
+#include <vector>
+
 Model_Update MY_UPDATER_INSTANCE;  /// the only one instance initialized on load of the library
 //#define DEB_UPDATE
 
@@ -344,6 +351,7 @@ void Model_Update::processEvent(const std::shared_ptr<Events_Message>& theMessag
       // on undo/redo, abort do not update persistent features
       FeaturePtr anUpdated = std::dynamic_pointer_cast<ModelAPI_Feature>(*anObjIter);
       if (anUpdated.get()) {
+        resetDependencies(anUpdated); // references of the feature may be changed
         if (addModified(anUpdated, FeaturePtr()))
           aSomeModified = true;
       } else {
@@ -444,8 +452,10 @@ void Model_Update::processEvent(const std::shared_ptr<Events_Message>& theMessag
   } else if (theMessage->eventID() == kReorderEvent) {
     std::shared_ptr<ModelAPI_OrderUpdatedMessage> aMsg =
       std::dynamic_pointer_cast<ModelAPI_OrderUpdatedMessage>(theMessage);
-    if (aMsg->reordered().get())
+    if (aMsg->reordered().get()) {
+      resetDependencies(aMsg->reordered());
       addModified(aMsg->reordered(), aMsg->reordered()); // to update all attributes
+    }
   }
 }
 
@@ -459,21 +469,40 @@ void Model_Update::processFeatures(const bool theFlushRedisplay)
     #endif
 
     while(!myModified.empty()) {
-      processFeature(myModified.begin()->first);
+      // one sweep in the order of dependencies; repeated if executions modified something
+      std::list<FeaturePtr> anOrder;
+      sortModified(anOrder);
+      if (ModelAPI_Session::get()->isParallelRebuild())
+        prepareConcurrently(anOrder);
+      std::list<FeaturePtr>::iterator aFeature = anOrder.begin();
+      for(; aFeature != anOrder.end() && !myModified.empty(); aFeature++) {
+        if (myModified.find(*aFeature) != myModified.end())
+          processFeature(*aFeature);
+      }
     }
     myIsProcessed = false;
 
+    // forget dependencies of removed features
+    std::map<std::weak_ptr<ModelAPI_Feature>, WeakFeatures,
+             std::owner_less<std::weak_ptr<ModelAPI_Feature> > >::iterator
+      aDep = myDependencies.begin();
+    while(aDep != myDependencies.end()) {
+      FeaturePtr aFeature = aDep->first.lock();
+      if (aFeature.get() && aFeature->data().get() && aFeature->data()->isValid())
+        aDep++;
+      else
+        aDep = myDependencies.erase(aDep);
+    }
+
     // to update the object browser if something is updated/created during executions
     static Events_Loop* aLoop = Events_Loop::loop();
-    static const Events_ID kCreatedEvent= aLoop->eventByName(EVENT_OBJECT_CREATED);
-    aLoop->flush(kCreatedEvent);
-    static const Events_ID kUpdatedEvent = aLoop->eventByName(EVENT_OBJECT_UPDATED);
-    aLoop->flush(kUpdatedEvent);
-
-    // flush to update display
-    if (theFlushRedisplay) {
-      static Events_ID EVENT_DISP = aLoop->eventByName(EVENT_OBJECT_TO_REDISPLAY);
-      aLoop->flush(EVENT_DISP);
+    if (theFlushRedisplay) { // and the display: everything in the order declared by the session
+      aLoop->flushAll();
+    } else {
+      static const Events_ID kCreatedEvent= aLoop->eventByName(EVENT_OBJECT_CREATED);
+      aLoop->flush(kCreatedEvent);
+      static const Events_ID kUpdatedEvent = aLoop->eventByName(EVENT_OBJECT_UPDATED);
+      aLoop->flush(kUpdatedEvent);
     }
     #ifdef DEB_UPDATE
       std::cout<<"****** End processing"<<std::endl;
@@ -482,13 +511,20 @@ void Model_Update::processFeatures(const bool theFlushRedisplay)
   }
 }
 
-// collects all the features this feature depends on: reasons
-static void allReasons(FeaturePtr theFeature, std::set<FeaturePtr>& theReasons) {
-  std::list<std::pair<std::string, std::list<std::shared_ptr<ModelAPI_Object> > > > aDeps;
-  theFeature->data()->referencesToObjects(aDeps);
+const Model_Update::WeakFeatures& Model_Update::dependencies(FeaturePtr theFeature)
+{
+  std::map<std::weak_ptr<ModelAPI_Feature>, WeakFeatures,
+           std::owner_less<std::weak_ptr<ModelAPI_Feature> > >::iterator
+    aFound = myDependencies.find(theFeature);
+  if (aFound != myDependencies.end())
+    return aFound->second;
+
+  WeakFeatures& aDeps = myDependencies[theFeature];
+  std::list<std::pair<std::string, std::list<std::shared_ptr<ModelAPI_Object> > > > aRefs;
+  theFeature->data()->referencesToObjects(aRefs);
   std::list<std::pair<std::string, std::list<std::shared_ptr<ModelAPI_Object> > > >::iterator
-    anAttrsIter = aDeps.begin();
-  for(; anAttrsIter != aDeps.end(); anAttrsIter++) {
+    anAttrsIter = aRefs.begin();
+  for(; anAttrsIter != aRefs.end(); anAttrsIter++) {
     if (theFeature->attribute(anAttrsIter->first)->isArgument()) {
       std::list<std::shared_ptr<ModelAPI_Object> >::iterator aDepIter = anAttrsIter->second.begin();
       for(; aDepIter != anAttrsIter->second.end(); aDepIter++) {
@@ -500,13 +536,32 @@ static void allReasons(FeaturePtr theFeature, std::set<FeaturePtr>& theReasons)
           }
         }
         if (aDepFeat.get() && aDepFeat->data()->isValid()) {
-          theReasons.insert(aDepFeat);
+          aDeps.insert(aDepFeat);
         }
       }
     }
   }
+  return aDeps;
+}
+
+void Model_Update::resetDependencies(FeaturePtr theFeature)
+{
+  myDependencies.erase(theFeature);
+}
+
+void Model_Update::allReasons(FeaturePtr theFeature, std::set<FeaturePtr>& theReasons)
+{
+  const WeakFeatures& aDeps = dependencies(theFeature);
+  WeakFeatures::const_iterator aDep = aDeps.cbegin();
+  for(; aDep != aDeps.cend(); aDep++) {
+    FeaturePtr aReason = aDep->lock();
+    // may be removed after the graph was computed
+    if (aReason.get() && aReason->data()->isValid())
+      theReasons.insert(aReason);
+  }
   if (theFeature->getKind() == "Part") {
     // part is not depended on its subs directly, but subs must be iterated anyway
+    // (they are not in the graph: subs are added and removed without update of the part)
     CompositeFeaturePtr aPart = std::dynamic_pointer_cast<ModelAPI_CompositeFeature>(theFeature);
     int aNum = aPart->numberOfSubs();
     for(int a = 0; a < aNum; a++) {
@@ -518,6 +573,115 @@ static void allReasons(FeaturePtr theFeature, std::set<FeaturePtr>& theReasons)
   }
 }
 
+void Model_Update::modifiedReasons(FeaturePtr theFeature, std::list<FeaturePtr>& theReasons)
+{
+  std::map<FeaturePtr, std::set<FeaturePtr> >::iterator aModif = myModified.find(theFeature);
+  if (aModif == myModified.end() || !theFeature->data()->isValid())
+    return;
+  std::set<FeaturePtr> anAll;
+  const std::set<FeaturePtr>* aReasons = &(aModif->second);
+  if (aReasons->find(theFeature) != aReasons->end()) { // all reasons are used
+    allReasons(theFeature, anAll);
+    aReasons = &anAll;
+  }
+  std::set<FeaturePtr>::const_iterator aReason = aReasons->cbegin();
+  for(; aReason != aReasons->cend(); aReason++) {
+    if (*aReason != theFeature && myModified.find(*aReason) != myModified.end())
+      theReasons.push_back(*aReason);
+  }
+}
+
+void Model_Update::sortModified(std::list<FeaturePtr>& theOrder)
+{
+  std::set<FeaturePtr> aVisited;
+  // depth-first search with explicit stack: feature and its modified reasons not visited yet
+  typedef std::pair<FeaturePtr, std::list<FeaturePtr> > StackItem;
+  std::list<StackItem> aStack;
+  std::map<FeaturePtr, std::set<FeaturePtr> >::iterator aModif = myModified.begin();
+  for(; aModif != myModified.end(); aModif++) {
+    if (!aVisited.insert(aModif->first).second)
+      continue;
+    aStack.push_back(StackItem(aModif->first, std::list<FeaturePtr>()));
+    modifiedReasons(aModif->first, aStack.back().second);
+    while(!aStack.empty()) {
+      std::list<FeaturePtr>& aReasons = aStack.back().second;
+      if (aReasons.empty()) { // all reasons are already in the order
+        theOrder.push_back(aStack.back().first);
+        aStack.pop_back();
+        continue;
+      }
+      FeaturePtr aReason = aReasons.front();
+      aReasons.pop_front();
+      if (aVisited.insert(aReason).second) {
+        aStack.push_back(StackItem(aReason, std::list<FeaturePtr>()));
+        modifiedReasons(aReason, aStack.back().second);
+      }
+    }
+  }
+}
+
+/// Functor for the parallel preparation of independent features
+class Model_PrepareFunctor
+{
+public:
+  /// Features to prepare and the errors of preparation for each of them
+  Model_PrepareFunctor(const std::vector<FeaturePtr>& theFeatures,
+                       std::vector<std::string>& theErrors)
+    : myFeatures(theFeatures), myErrors(theErrors) {}
+
+  /// Prepares one feature; exceptions are not propagated: execute will repeat the computation
+  void operator()(const int theIndex) const
+  {
+    try {
+      myFeatures[theIndex]->prepareExecution();
+    } catch(Standard_Failure const& anException) {
+      myErrors[theIndex] = anException.GetMessageString();
+    } catch(std::exception const& anException) {
+      myErrors[theIndex] = anException.what();
+    }
+  }
+
+private:
+  const std::vector<FeaturePtr>& myFeatures; ///< features to prepare
+  std::vector<std::string>& myErrors; ///< errors of preparation, by the index of the feature
+};
+
+void Model_Update::prepareConcurrently(const std::list<FeaturePtr>& theOrder)
+{
+  // the data model is not thread-safe, so, only the first frontier of the modified features is
+  // prepared: arguments of the next ones are updated by execution of the previous features
+  std::vector<FeaturePtr> aReady;
+  std::list<FeaturePtr>::const_iterator aFeature = theOrder.cbegin();
+  for(; aFeature != theOrder.cend(); aFeature++) {
+    if (!(*aFeature)->data()->isValid() || (*aFeature)->isDisabled())
+      continue;
+    if ((*aFeature)->isPersistentResult() &&
+        !std::dynamic_pointer_cast<Model_Document>((*aFeature)->document())->executeFeatures())
+      continue;
+    std::list<FeaturePtr> aReasons;
+    modifiedReasons(*aFeature, aReasons);
+    // arguments are read here, in the main thread: workers do not access the data model
+    if (aReasons.empty() && (*aFeature)->prepareArguments())
+      aReady.push_back(*aFeature);
+  }
+  if (aReady.size() < 2) // for a single feature the preparation is made by execute directly
+    return;
+  std::vector<std::string> anErrors(aReady.size());
+  OSD_Parallel::For(0, (int)aReady.size(), Model_PrepareFunctor(aReady, anErrors));
+  int aNbPrepared = 0;
+  for(size_t anIndex = 0; anIndex < aReady.size(); anIndex++) {
+    if (!anErrors[anIndex].empty()) {
+      Events_InfoMessage("Model_Update", "Preparation of feature %1 has failed: %2")
+        .arg(aReady[anIndex]->getKind()).arg(anErrors[anIndex]).send();
+    } else
+      aNbPrepared++;
+  }
+  std::shared_ptr<Model_Session> aSession =
+    std::dynamic_pointer_cast<Model_Session>(ModelAPI_Session::get());
+  if (aSession.get())
+    aSession->addParallelPrepared(aNbPrepared);
+}
+
 bool Model_Update::processFeature(FeaturePtr theFeature)
 {
   static ModelAPI_ValidatorsFactory* aFactory = ModelAPI_Session::get()->validators();
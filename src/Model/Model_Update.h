@@ -26,6 +26,7 @@
 #include <memory>
 #include <set>
 #include <map>
+#include <list>
 
 class ModelAPI_Object;
 class ModelAPI_Feature;
@@ -61,6 +62,13 @@ class Model_Update : public Events_Listener
     myProcessOnFinish;
   /// to avoid infinitive cycling: feature -> count of the processing periods during this update
   std::map<std::shared_ptr<ModelAPI_Feature>, int > myProcessed;
+  /// Features of the dependencies graph: weak, so, the graph does not keep removed features
+  typedef std::set<std::weak_ptr<ModelAPI_Feature>,
+                   std::owner_less<std::weak_ptr<ModelAPI_Feature> > > WeakFeatures;
+  /// Dependencies graph: feature -> features it depends on by its arguments. It is persistent
+  /// between updates: computed from the data references once and reset on the feature change.
+  std::map<std::weak_ptr<ModelAPI_Feature>, WeakFeatures,
+           std::owner_less<std::weak_ptr<ModelAPI_Feature> > > myDependencies;
   /// if preview in the property panel is blocked any update is postponed until end of operation
   bool myIsPreviewBlocked;
   /// disables any update if it is true, even on start/finish operation, undo, etc.
@@ -81,6 +89,28 @@ protected:
   bool addModified(
     std::shared_ptr<ModelAPI_Feature> theFeature, std::shared_ptr<ModelAPI_Feature> theReason);
 
+  /// Returns features theFeature depends on: from the dependencies graph, computed if needed
+  const WeakFeatures& dependencies(std::shared_ptr<ModelAPI_Feature> theFeature);
+
+  /// Collects all the valid features this feature depends on: reasons
+  void allReasons(std::shared_ptr<ModelAPI_Feature> theFeature,
+                  std::set<std::shared_ptr<ModelAPI_Feature> >& theReasons);
+
+  /// Removes the feature dependencies from the graph: its references may be changed
+  void resetDependencies(std::shared_ptr<ModelAPI_Feature> theFeature);
+
+  /// Appends to theReasons the modified features that must be processed before theFeature
+  void modifiedReasons(std::shared_ptr<ModelAPI_Feature> theFeature,
+                       std::list<std::shared_ptr<ModelAPI_Feature> >& theReasons);
+
+  /// Sorts the modified features in the order of processing: all the modified reasons of
+  /// a feature are before it, so, each feature is processed once, without recursion
+  void sortModified(std::list<std::shared_ptr<ModelAPI_Feature> >& theOrder);
+
+  /// Prepares concurrently the modified features of theOrder that have no modified reasons:
+  /// they are independent, so, the shapes are built in parallel, results are stored by execute
+  void prepareConcurrently(const std::list<std::shared_ptr<ModelAPI_Feature> >& theOrder);
+
   /// Recoursively checks and updates features if needed (calls the execute method)
   /// Returns true if feature was updated.
   bool processFeature(std::shared_ptr<ModelAPI_Feature> theFeature);
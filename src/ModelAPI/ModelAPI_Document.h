@@ -241,6 +241,10 @@ public:
   virtual bool isLater(std::shared_ptr<ModelAPI_Feature> theLater,
                        std::shared_ptr<ModelAPI_Feature> theCurrent) const = 0;
 
+  /// Returns the position of the feature in history of features creation (fast, cached),
+  /// or -1 if the feature is not found. Only the order of positions is meaningful.
+  virtual int featureIndex(std::shared_ptr<ModelAPI_Feature> theFeature) const = 0;
+
   //! Internally makes document know that feature was removed or added in history after creation
   MODELAPI_EXPORT virtual void updateHistory(const std::string theGroup) = 0;
 
@@ -77,6 +77,16 @@ class ModelAPI_Feature : public ModelAPI_Object
   /// \return a boolean value about it is computed
   virtual bool compute(const std::string& /*theAttributeId*/) { return false; };
 
+  /// Called in the main thread before prepareExecution: copies the arguments needed for the
+  /// preparation from the data model to plain values of the feature.
+  /// Returns false if the feature can not be prepared concurrently (default).
+  virtual bool prepareArguments() { return false; }
+
+  /// Computes the results of the next execute call from the values copied by prepareArguments:
+  /// it is called in a worker thread, so, it must not access the data model at all.
+  /// The execute must use the prepared shapes if the arguments are not changed since this call.
+  virtual void prepareExecution() {}
+
   /// Registers error during the execution, causes the ExecutionFailed state
   MODELAPI_EXPORT virtual void setError(const std::string& theError,
                                         bool isSend = true,
@@ -53,6 +53,11 @@ public:
   /// Returns True if the filter can be used several times within one filtering
   virtual bool isMultiple() const { return false; }
 
+  /// Returns True if isOk may be called from several threads at once: the filter does not
+  /// change its own state, reads only simple arguments (not selections) and takes the owner
+  /// body from the arguments instead of searching it in the data model
+  virtual bool isThreadSafe() const { return false; }
+
   /// Returns XML string which represents GUI of the filter
   /// By default it returns nothing (no GUI)
   virtual std::string xmlRepresentation() const { return ""; }
@@ -20,7 +20,9 @@
 #ifndef ModelAPI_FiltersArgs_H_
 #define ModelAPI_FiltersArgs_H_
 
+#include "ModelAPI_FiltersCache.h"
 #include "ModelAPI_FiltersFeature.h"
+#include "ModelAPI_ResultBody.h"
 
 #include <map>
 
@@ -33,6 +35,10 @@ class ModelAPI_FiltersArgs {
   std::map<std::string, AttributePtr> myMap;
   std::string myCurrentFilter; ///< ID of the filter that will take attributes now
   FiltersFeaturePtr myFeature; ///< the feature is stored to minimize initAttribute interface
+  /// data computed by filters, shared by checks of shapes; created on demand if not set
+  mutable FiltersCachePtr myCache;
+  ResultBodyPtr myOwner; ///< the root body of the checked shapes, if known
+  GeomShapePtr myOwnerShape; ///< the shape of myOwner
 public:
   ModelAPI_FiltersArgs() {}
 
@@ -55,6 +61,35 @@ public:
   AttributePtr argument(const std::string& theID) const {
     return myMap.find(myCurrentFilter + kFilterSeparator + theID)->second;
   }
+  /// Sets the cache of the data computed by filters
+  void setCache(const FiltersCachePtr& theCache) {
+    myCache = theCache;
+  }
+
+  /// returns the cache of the data computed by filters
+  const FiltersCachePtr& cache() const {
+    if (!myCache) // not shared by the factory: the data is kept for these arguments only
+      myCache.reset(new ModelAPI_FiltersCache);
+    return myCache;
+  }
+
+  /// Sets the root body of the checked shapes and its shape. They are resolved in the main
+  /// thread by the factory, so, the filters do not access the data model from other threads.
+  void setOwner(const ResultBodyPtr& theOwner, const GeomShapePtr& theOwnerShape) {
+    myOwner = theOwner;
+    myOwnerShape = theOwnerShape;
+  }
+
+  /// returns the root body of the checked shapes, or null if it is not known
+  const ResultBodyPtr& owner() const {
+    return myOwner;
+  }
+
+  /// returns the shape of the root body of the checked shapes, or null if it is not known
+  const GeomShapePtr& ownerShape() const {
+    return myOwnerShape;
+  }
+
   /// adds an attribute of the filter
   std::shared_ptr<ModelAPI_Attribute> initAttribute(
     const std::string& theID, const std::string theAttrType) {
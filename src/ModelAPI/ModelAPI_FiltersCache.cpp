@@ -0,0 +1,82 @@
+// Copyright (C) 2014-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "ModelAPI_FiltersCache.h"
+
+ModelAPI_FiltersCache::ModelAPI_FiltersCache(const size_t theSize)
+  : mySize(theSize)
+{
+}
+
+std::list<ModelAPI_FiltersCache::Entry>::iterator ModelAPI_FiltersCache::findEntry(
+  const std::string& theKey, const std::list<GeomShapePtr>& theShapes)
+{
+  std::list<Entry>::iterator anEntry = myEntries.begin();
+  for (; anEntry != myEntries.end(); ++anEntry) {
+    if (anEntry->myKey != theKey || anEntry->myShapes.size() != theShapes.size())
+      continue;
+    std::list<GeomShapePtr>::const_iterator aShape = theShapes.begin();
+    std::list<GeomShapePtr>::const_iterator aStored = anEntry->myShapes.begin();
+    for (; aShape != theShapes.end(); ++aShape, ++aStored) {
+      if (aShape->get() != aStored->get() &&
+         (!aShape->get() || !aStored->get() || !(*aShape)->isSame(*aStored)))
+        break;
+    }
+    if (aShape == theShapes.end())
+      break;
+  }
+  return anEntry;
+}
+
+FilterDataPtr ModelAPI_FiltersCache::find(const std::string& theKey,
+                                          const std::list<GeomShapePtr>& theShapes)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  std::list<Entry>::iterator anEntry = findEntry(theKey, theShapes);
+  if (anEntry == myEntries.end())
+    return FilterDataPtr();
+  if (anEntry != myEntries.begin())
+    myEntries.splice(myEntries.begin(), myEntries, anEntry);
+  return myEntries.front().myData;
+}
+
+void ModelAPI_FiltersCache::store(const std::string& theKey,
+                                  const std::list<GeomShapePtr>& theShapes,
+                                  const FilterDataPtr& theData)
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  // the same data may be computed by several threads at once: keep one
+  std::list<Entry>::iterator anEntry = findEntry(theKey, theShapes);
+  if (anEntry != myEntries.end())
+    myEntries.erase(anEntry);
+
+  Entry aNew;
+  aNew.myKey = theKey;
+  aNew.myShapes = theShapes;
+  aNew.myData = theData;
+  myEntries.push_front(aNew);
+  if (myEntries.size() > mySize)
+    myEntries.pop_back();
+}
+
+void ModelAPI_FiltersCache::clear()
+{
+  std::lock_guard<std::mutex> aLock(myMutex);
+  myEntries.clear();
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2014-2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef ModelAPI_FiltersCache_H_
+#define ModelAPI_FiltersCache_H_
+
+#include "ModelAPI.h"
+
+#include <GeomAPI_Shape.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/// data computed by a filter once for all checked sub-shapes (like maps of ancestors)
+class ModelAPI_FilterData {
+public:
+  virtual ~ModelAPI_FilterData() {}
+};
+
+typedef std::shared_ptr<ModelAPI_FilterData> FilterDataPtr;
+
+/**\class ModelAPI_FiltersCache
+* \ingroup DataModel
+* \brief Data computed by filters, kept between the checks of shapes.
+*
+* The data is identified by a key, which contains the filter kind and the values of its
+* arguments, and by the shapes it is computed on (a body, selected shapes). The cache keeps
+* only the last used data. It may be accessed from several threads.
+*/
+class ModelAPI_FiltersCache
+{
+public:
+  /// Creates an empty cache that keeps theSize of the last used data
+  MODELAPI_EXPORT ModelAPI_FiltersCache(const size_t theSize = 16);
+
+  /// Returns the data stored for theKey and the same shapes, or null
+  MODELAPI_EXPORT FilterDataPtr find(const std::string& theKey,
+                                     const std::list<GeomShapePtr>& theShapes);
+
+  /// Keeps the data computed for theKey on theShapes
+  MODELAPI_EXPORT void store(const std::string& theKey,
+                             const std::list<GeomShapePtr>& theShapes,
+                             const FilterDataPtr& theData);
+
+  /// Forgets all the data
+  MODELAPI_EXPORT void clear();
+
+private:
+  /// data with the key and the shapes, kept alive to be compared with the requested ones
+  struct Entry {
+    std::string myKey;
+    std::list<GeomShapePtr> myShapes;
+    FilterDataPtr myData;
+  };
+
+  /// Returns an iterator to the entry with the same key and shapes
+  std::list<Entry>::iterator findEntry(const std::string& theKey,
+                                       const std::list<GeomShapePtr>& theShapes);
+
+  std::list<Entry> myEntries; ///< the most recently used first
+  size_t mySize; ///< maximal number of entries
+  std::mutex myMutex; ///< protects the entries
+};
+
+typedef std::shared_ptr<ModelAPI_FiltersCache> FiltersCachePtr;
+
+#endif
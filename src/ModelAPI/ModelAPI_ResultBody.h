@@ -227,6 +227,11 @@ public:
                           (std::map< std::wstring, std::shared_ptr<GeomAPI_Shape> > &theShapeName,
                            std::map< std::wstring, std::vector<int>> & theColorsShape) = 0;
 
+  /// Get the map of name and color read shape in step file
+  MODELAPI_EXPORT virtual void getShapeName
+                          (std::map< std::wstring, std::shared_ptr<GeomAPI_Shape> > &theShapeName,
+                           std::map< std::wstring, std::vector<int>> & theColorsShape) = 0;
+
   /// Clear the map of name and color read shape in step file
   MODELAPI_EXPORT virtual void clearShapeNameAndColor() = 0;
 
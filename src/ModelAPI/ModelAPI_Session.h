@@ -149,6 +149,23 @@ protected:
   /// Set state of the auto-update of features result in the application
   virtual void blockAutoUpdate(const bool theBlock) = 0;
 
+  /// Returns true if independent features are prepared for execution concurrently on rebuild
+  virtual bool isParallelRebuild() { return false; }
+
+  /// Enables or disables the parallel preparation of independent features on rebuild
+  virtual void setParallelRebuild(const bool /*theParallel*/) {}
+
+  /// Returns the number of features prepared concurrently since the session start
+  virtual int parallelPreparedNumber() { return 0; }
+
+  /// Returns true if boolean operations run in parallel
+  virtual bool isParallelBooleans() { return false; }
+
+  /// Enables or disables the parallel mode of boolean operations.
+  /// \param theParallel parallel mode
+  /// \param theNbThreads maximal number of threads, all processors are used if not positive
+  virtual void setParallelBooleans(const bool /*theParallel*/, const int /*theNbThreads*/ = 0) {}
+
  protected:
   /// Sets the session interface implementation (once per application launch)
   static void setSession(std::shared_ptr<ModelAPI_Session> theManager);
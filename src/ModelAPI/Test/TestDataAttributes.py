@@ -0,0 +1,99 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Checks the add, the search and the removal of attributes of the data and the
+# search of the attribute identifier by the attribute, also after undo and redo.
+#===============================================================================
+from salome.shaper import model
+from ModelAPI import *
+
+def checkAttributes(theData):
+  anIDs = list(theData.attributesIDs(""))
+  assert(len(anIDs) > 0)
+  assert(anIDs == sorted(anIDs)), "Attributes are not iterated in the order of identifiers"
+  anAttrs = theData.attributes("")
+  assert(len(anAttrs) == len(anIDs))
+  for anAttr, anID in zip(anAttrs, anIDs):
+    assert(anAttr.id() == anID)
+    assert(theData.id(anAttr) == anID), "Wrong identifier of attribute {}".format(anID)
+    aFound = theData.attribute(anID)
+    assert(aFound is not None), "Attribute {} is not found".format(anID)
+    assert(theData.id(aFound) == anID)
+    assert(aFound.attributeType() == anAttr.attributeType())
+  for aType in [ModelAPI_AttributeDouble.typeId(), ModelAPI_AttributeBoolean.typeId()]:
+    for anID in theData.attributesIDs(aType):
+      assert(theData.attribute(anID).attributeType() == aType)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+model.end()
+
+aData = Box_1.feature().data()
+checkAttributes(aData)
+assert(aData.attribute("no_such_attribute") is None)
+aNbAttrs = len(aData.attributesIDs(""))
+
+# floating attributes are added to and removed from the data
+model.begin()
+aFlag = aData.addFloatingAttribute("flag", ModelAPI_AttributeBoolean.typeId(), "checked")
+aValue = aData.addFloatingAttribute("value", ModelAPI_AttributeDouble.typeId(), "checked")
+modelAPI_AttributeBoolean(aFlag).setValue(True)
+modelAPI_AttributeDouble(aValue).setValue(1.)
+model.end()
+assert(aFlag is not None and aValue is not None)
+assert(aData.id(aFlag) == "checked__flag")
+assert(aData.id(aValue) == "checked__value")
+assert(aData.attribute("checked__flag").attributeType() == ModelAPI_AttributeBoolean.typeId())
+assert("checked__value" in aData.attributesIDs(ModelAPI_AttributeDouble.typeId()))
+assert(len(aData.attributesIDs("")) == aNbAttrs + 2)
+checkAttributes(aData)
+
+model.begin()
+aData.removeAttributes("checked")
+model.end()
+assert(aData.attribute("checked__flag") is None)
+assert(aData.attribute("checked__value") is None)
+assert(len(aData.attributesIDs("")) == aNbAttrs)
+checkAttributes(aData)
+
+# the data of the feature restored by undo/redo is initialized again
+model.begin()
+Box_1.setName("MyBox")
+model.end()
+model.undo()
+model.undo()
+model.undo()
+model.redo()
+model.redo()
+model.redo()
+aFeature = objectToFeature(Part_1_doc.objectByName("Features", "MyBox"))
+assert(aFeature is not None)
+assert(aFeature.data().name() == "MyBox")
+checkAttributes(aFeature.data())
+assert(len(aFeature.data().attributesIDs("")) == aNbAttrs)
+
+model.undo()
+aFeature = objectToFeature(Part_1_doc.objectByName("Features", "Box_1"))
+assert(aFeature is not None)
+assert(aFeature.data().name() == "Box_1")
+checkAttributes(aFeature.data())
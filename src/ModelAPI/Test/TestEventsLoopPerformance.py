@@ -0,0 +1,84 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Micro-benchmark of the Events_Loop send/flush throughput.
+# Sends many grouped and not grouped messages of a dedicated event (so, model
+# listeners are not involved) and checks that all of them are delivered and
+# that grouping of messages is faster than their direct delivery.
+#===============================================================================
+import time
+
+from salome.shaper import model
+
+from EventsAPI import *
+from ModelAPI import *
+
+NB_SENDS = 100000
+NB_FLUSHES = 100
+
+class CountingListener(EventsAPI.Events_Listener):
+    def __init__(self, theEvent):
+        Events_Listener.__init__(self)
+        Events_Loop.loop().registerListener(self, theEvent)
+        self.myMessages = 0
+        self.myObjects = 0
+
+    def __del__(self):
+        Events_Loop.loop().removeListener(self)
+
+    def processEvent(self, theMessage):
+        self.myMessages += 1
+        self.myObjects += len(messageToUpdatedMessage(theMessage).objects())
+
+
+model.begin()
+partSet = model.moduleDocument()
+Point_1 = model.addPoint(partSet, 0, 0, 0)
+Point_2 = model.addPoint(partSet, 10, 0, 0)
+model.end()
+anObjects = [Point_1.feature(), Point_2.feature()]
+
+anEvent = Events_Loop.eventByName("EventsLoopPerformance")
+aListener = CountingListener(anEvent)
+aCreator = ModelAPI_EventCreator.get()
+aLoop = Events_Loop.loop()
+
+# grouped messages: accumulated by the loop, delivered once per flush
+aStart = time.perf_counter()
+for i in range(NB_SENDS):
+    aCreator.sendUpdated(anObjects[i % 2], anEvent)
+    if (i + 1) % (NB_SENDS // NB_FLUSHES) == 0:
+        aLoop.flush(anEvent)
+aGrouped = time.perf_counter() - aStart
+assert(aListener.myMessages == NB_FLUSHES)
+assert(aListener.myObjects == 2 * NB_FLUSHES)
+assert(not aLoop.hasGrouppedEvent(anEvent))
+
+# not grouped messages: delivered to the listener immediately
+aStart = time.perf_counter()
+for i in range(NB_SENDS):
+    aCreator.sendUpdated(anObjects[i % 2], anEvent, False)
+aDirect = time.perf_counter() - aStart
+assert(aListener.myMessages == NB_FLUSHES + NB_SENDS)
+
+# accumulation of the grouped messages must not cost more than the delivery of each message
+assert(aGrouped < aDirect), "Grouped sends are slower than direct sends: {:.3f} s > {:.3f} s".format(aGrouped, aDirect)
+
+del aListener
@@ -0,0 +1,81 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Checks that flushAll merges the duplicate objects of the accumulated messages:
+# the listener receives one message with each object once, and the number of
+# the joined messages is counted by the loop.
+#===============================================================================
+from salome.shaper import model
+
+from EventsAPI import *
+from ModelAPI import *
+
+NB_SENDS = 10
+
+class CollectingListener(EventsAPI.Events_Listener):
+    def __init__(self, theEvent):
+        Events_Listener.__init__(self)
+        Events_Loop.loop().registerListener(self, theEvent)
+        self.myMessages = 0
+        self.myObjects = []
+
+    def __del__(self):
+        Events_Loop.loop().removeListener(self)
+
+    def processEvent(self, theMessage):
+        self.myMessages += 1
+        self.myObjects.extend(messageToUpdatedMessage(theMessage).objects())
+
+
+model.begin()
+partSet = model.moduleDocument()
+Point_1 = model.addPoint(partSet, 0, 0, 0)
+Point_2 = model.addPoint(partSet, 10, 0, 0)
+model.end()
+anObjects = [Point_1.feature(), Point_2.feature()]
+
+# redisplay is one of the events flushed by flushAll in the order declared by the session
+anEvent = Events_Loop.eventByName("ObjectsToRedisplay")
+aListener = CollectingListener(anEvent)
+aCreator = ModelAPI_EventCreator.get()
+aLoop = Events_Loop.loop()
+
+aCoalescedBefore = aLoop.coalescedMessages()
+for i in range(NB_SENDS):
+    aCreator.sendUpdated(anObjects[i % 2], anEvent)
+aCoalesced = aLoop.flushAll()
+assert(aLoop.coalescedMessages() - aCoalescedBefore == aCoalesced)
+# all the sent messages are joined into one group
+assert(aCoalesced >= NB_SENDS - 1), "Joined {} messages of {}".format(aCoalesced, NB_SENDS)
+assert(not aLoop.hasGrouppedEvent(anEvent))
+# the group is delivered once with each object once
+assert(aListener.myMessages == 1)
+assert(len(aListener.myObjects) == 2)
+for anObject in anObjects:
+    assert(len([anObj for anObj in aListener.myObjects if anObj.data().isEqual(anObject.data())]) == 1)
+
+# the same objects in the next groups are delivered again, once per group
+for i in range(NB_SENDS):
+    aCreator.sendUpdated(anObjects[0], anEvent)
+aLoop.flushAll()
+assert(aListener.myMessages == 2)
+assert(len(aListener.myObjects) == 3)
+
+del aListener
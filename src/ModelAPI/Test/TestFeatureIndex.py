@@ -0,0 +1,58 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Checks the cached order of features in the history: featureIndex and isLater
+# must follow the creation, movement, removal of features and undo/redo.
+#===============================================================================
+from salome.shaper import model
+from ModelAPI import *
+
+def checkOrder(theDoc, theFeatures):
+  for i in range(len(theFeatures) - 1):
+    aPrev = theFeatures[i].feature()
+    aNext = theFeatures[i + 1].feature()
+    assert(theDoc.featureIndex(aPrev) < theDoc.featureIndex(aNext))
+    assert(theDoc.isLater(aNext, aPrev))
+    assert(not theDoc.isLater(aPrev, aNext))
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Box_2 = model.addBox(Part_1_doc, 20, 20, 20)
+Box_3 = model.addBox(Part_1_doc, 30, 30, 30)
+model.end()
+checkOrder(Part_1_doc, [Box_1, Box_2, Box_3])
+
+model.begin()
+Part_1_doc.moveFeature(Box_1.feature(), Box_3.feature())
+model.end()
+checkOrder(Part_1_doc, [Box_2, Box_3, Box_1])
+
+model.undo()
+checkOrder(Part_1_doc, [Box_1, Box_2, Box_3])
+model.redo()
+checkOrder(Part_1_doc, [Box_2, Box_3, Box_1])
+
+model.begin()
+Part_1_doc.removeFeature(Box_3.feature())
+model.end()
+checkOrder(Part_1_doc, [Box_2, Box_1])
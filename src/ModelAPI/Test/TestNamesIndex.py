@@ -0,0 +1,99 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Checks that the search of objects by names (objectByName and the search of
+# selection contexts by name) follows renaming of objects, undo and redo.
+#===============================================================================
+from salome.shaper import model
+from ModelAPI import *
+from GeomAlgoAPI import GeomAlgoAPI_ShapeTools
+
+def checkFeature(theDoc, theName, theSize):
+  aFeature = objectToFeature(theDoc.objectByName("Features", theName))
+  if theSize is None:
+    assert(aFeature is None), "Feature {} must not be found".format(theName)
+  else:
+    assert(aFeature is not None), "Feature {} is not found".format(theName)
+    assert(aFeature.name() == theName)
+    assert(aFeature.real("dx").value() == theSize), "Wrong feature {}".format(theName)
+
+def checkBody(theDoc, theName, theSize):
+  aBody = theDoc.objectByName("Bodies", theName)
+  if theSize is None:
+    assert(aBody is None), "Result {} must not be found".format(theName)
+  else:
+    assert(aBody is not None), "Result {} is not found".format(theName)
+    assert(aBody.data().name() == theName)
+    aVolume = GeomAlgoAPI_ShapeTools.volume(objectToResult(aBody).shape())
+    assert(abs(aVolume - theSize**3) < 1.e-7), "Wrong result {}".format(theName)
+
+def checkRenamed(theDoc):
+  checkFeature(theDoc, "MyBox", 10)
+  checkBody(theDoc, "MyBox_1", 10)
+  checkFeature(theDoc, "Box_1", 20)
+  checkBody(theDoc, "Box_1_1", 20)
+  checkFeature(theDoc, "Box_2", None)
+  checkBody(theDoc, "Box_2_1", None)
+
+def checkInitial(theDoc):
+  checkFeature(theDoc, "Box_1", 10)
+  checkBody(theDoc, "Box_1_1", 10)
+  checkFeature(theDoc, "Box_2", 20)
+  checkBody(theDoc, "Box_2_1", 20)
+  checkFeature(theDoc, "MyBox", None)
+  checkBody(theDoc, "MyBox_1", None)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Box_1 = model.addBox(Part_1_doc, 10, 10, 10)
+Box_2 = model.addBox(Part_1_doc, 20, 20, 20)
+model.end()
+checkInitial(Part_1_doc)
+
+# the second box takes the name of the first one
+model.begin()
+Box_1.setName("MyBox")
+Box_1.result().setName("MyBox_1")
+Box_2.setName("Box_1")
+Box_2.result().setName("Box_1_1")
+model.end()
+checkRenamed(Part_1_doc)
+
+model.undo()
+checkInitial(Part_1_doc)
+model.redo()
+checkRenamed(Part_1_doc)
+model.undo()
+checkInitial(Part_1_doc)
+model.redo()
+checkRenamed(Part_1_doc)
+
+# contexts of selections are searched by names of results
+model.begin()
+Group_1 = model.addGroup(Part_1_doc, "SOLID", [model.selection("SOLID", "MyBox_1")])
+Group_2 = model.addGroup(Part_1_doc, "SOLID", [model.selection("SOLID", "Box_1_1")])
+model.end()
+model.testResultsVolumes(Group_1, [1000])
+model.testResultsVolumes(Group_2, [8000])
+
+model.undo()
+checkRenamed(Part_1_doc)
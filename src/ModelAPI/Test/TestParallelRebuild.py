@@ -0,0 +1,114 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Rebuild of independent features with the parallel preparation of features enabled:
+# results must be the same as for the serial rebuild.
+#===============================================================================
+from salome.shaper import model
+from ModelAPI import *
+
+aSession = ModelAPI_Session.get()
+assert(not aSession.isParallelRebuild())
+aSession.setParallelRebuild(True)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+Param_L = model.addParameter(Part_1_doc, "L", "10")
+aBoxes = []
+for i in range(8):
+  aBoxes.append(model.addBox(Part_1_doc, "L", "L", "L"))
+aBoxes.append(model.addBox(Part_1_doc, 1, 1, 1, "L", "L", "L"))
+Fuse_1 = model.addFuse(Part_1_doc, [model.selection("SOLID", "Box_1_1"), model.selection("SOLID", "Box_9_1")], True)
+model.end()
+
+for aBox in aBoxes[:-1]:
+  model.testResultsVolumes(aBox, [1000])
+model.testResultsVolumes(aBoxes[-1], [8000])
+
+# all boxes are modified by the parameter, the fuse is updated after the first box
+model.begin()
+Param_L.setValue(20)
+model.end()
+
+for aBox in aBoxes[:-1]:
+  model.testResultsVolumes(aBox, [8000])
+model.testResultsVolumes(aBoxes[-1], [64000])
+model.testNbResults(Fuse_1, 1)
+
+# extrusions and booleans of not modified arguments are prepared concurrently
+model.begin()
+Sketch_1 = model.addSketch(Part_1_doc, model.defaultPlane("XOY"))
+Sketch_1.addCircle(0, 0, 5)
+Sketch_2 = model.addSketch(Part_1_doc, model.defaultPlane("XOY"))
+Sketch_2.addCircle(0, 0, 5)
+model.do()
+Extrusion_1 = model.addExtrusion(Part_1_doc, [model.selection("COMPOUND", "Sketch_1")], model.selection(), 10, 0)
+Extrusion_2 = model.addExtrusion(Part_1_doc, [model.selection("COMPOUND", "Sketch_2")], model.selection(), 10, 0)
+model.addBox(Part_1_doc, 10, 10, 10)
+model.addBox(Part_1_doc, 5, 5, 5)
+model.addBox(Part_1_doc, 10, 10, 10)
+model.addBox(Part_1_doc, 5, 5, 5)
+model.addBox(Part_1_doc, 10, 10, 10)
+model.addBox(Part_1_doc, 5, 5, 5)
+Cut_1 = model.addCut(Part_1_doc, [model.selection("SOLID", "Box_10_1")], [model.selection("SOLID", "Box_11_1")])
+Cut_2 = model.addCut(Part_1_doc, [model.selection("SOLID", "Box_12_1")], [model.selection("SOLID", "Box_13_1")])
+Common_1 = model.addCommon(Part_1_doc, [model.selection("SOLID", "Box_14_1")], [model.selection("SOLID", "Box_15_1")])
+model.end()
+
+# attributes are changed without the flush of the update by the high-level API,
+# so, all the features are updated together by the end of the transaction
+aNbPrepared = aSession.parallelPreparedNumber()
+model.begin()
+Extrusion_1.feature().real("to_size").setValue(20)
+Extrusion_2.feature().real("to_size").setValue(30)
+Cut_1.feature().boolean("use_fuzzy").setValue(True)
+Cut_1.feature().real("fuzzy_param").setValue(1.e-7)
+Cut_2.feature().boolean("use_fuzzy").setValue(True)
+Cut_2.feature().real("fuzzy_param").setValue(1.e-7)
+Common_1.feature().boolean("use_fuzzy").setValue(True)
+Common_1.feature().real("fuzzy_param").setValue(1.e-7)
+model.end()
+assert(aSession.parallelPreparedNumber() - aNbPrepared == 5)
+
+model.testResultsVolumes(Extrusion_1, [1570.796326794897])
+model.testResultsVolumes(Extrusion_2, [2356.194490192345])
+model.testResultsVolumes(Cut_1, [875])
+model.testResultsVolumes(Cut_2, [875])
+model.testResultsVolumes(Common_1, [125])
+
+# the same results without the concurrent preparation
+aSession.setParallelRebuild(False)
+aNbPrepared = aSession.parallelPreparedNumber()
+model.begin()
+Extrusion_1.feature().real("to_size").setValue(10)
+Extrusion_2.feature().real("to_size").setValue(10)
+Cut_1.feature().boolean("use_fuzzy").setValue(False)
+Cut_2.feature().boolean("use_fuzzy").setValue(False)
+Common_1.feature().boolean("use_fuzzy").setValue(False)
+model.end()
+assert(aSession.parallelPreparedNumber() == aNbPrepared)
+
+model.testResultsVolumes(Extrusion_1, [785.398163397448])
+model.testResultsVolumes(Extrusion_2, [785.398163397448])
+model.testResultsVolumes(Cut_1, [875])
+model.testResultsVolumes(Cut_2, [875])
+model.testResultsVolumes(Common_1, [125])
@@ -0,0 +1,116 @@
+# Copyright (C) 2014-2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+#
+
+#===============================================================================
+# Checks that undo/redo keeps the back references and the concealment of objects
+# consistent when only a part of the document is modified by the transaction.
+#===============================================================================
+from salome.shaper import model
+from ModelAPI import *
+
+NB_BOXES = 20
+
+def checkState(theDoc, theBoxes, theConcealed):
+  assert(theDoc.size("Bodies") == len(theBoxes) - len(theConcealed) + (len(theConcealed) > 0))
+  for i in range(len(theBoxes)):
+    aResult = theBoxes[i].feature().firstResult()
+    assert(aResult.isConcealed() == (i in theConcealed)), \
+      "Wrong concealment of Box_{}".format(i + 1)
+    # back references are updated incrementally: only the Cut may refer to the box
+    aRefs = [aRef for aRef in aResult.data().refsToMe()
+             if objectToFeature(aRef.owner()).getKind() == "Cut"]
+    assert(len(aRefs) == (i in theConcealed)), "Wrong back references of Box_{}".format(i + 1)
+
+model.begin()
+partSet = model.moduleDocument()
+Part_1 = model.addPart(partSet)
+Part_1_doc = Part_1.document()
+aBoxes = []
+for i in range(NB_BOXES):
+  aBoxes.append(model.addBox(Part_1_doc, 10, 10, 10))
+model.end()
+checkState(Part_1_doc, aBoxes, [])
+
+model.begin()
+Cut_1 = model.addCut(Part_1_doc, [model.selection("SOLID", "Box_1_1")],
+                     [model.selection("SOLID", "Box_2_1")])
+model.end()
+checkState(Part_1_doc, aBoxes, [0, 1])
+
+model.undo()
+checkState(Part_1_doc, aBoxes, [])
+model.redo()
+checkState(Part_1_doc, aBoxes, [0, 1])
+
+# the redone Cut is a new object: the wrapper created before undo refers to the erased one
+aCut = objectToFeature(Part_1_doc.objectByName("Features", "Cut_1"))
+
+# change the referenced object: back references of both tools must follow undo/redo
+model.begin()
+aTools = aCut.selectionList("tool_objects")
+aTools.clear()
+aTools.append("Box_3_1", "SOLID")
+model.end()
+checkState(Part_1_doc, aBoxes, [0, 2])
+
+model.undo()
+checkState(Part_1_doc, aBoxes, [0, 1])
+model.redo()
+checkState(Part_1_doc, aBoxes, [0, 2])
+
+# removed feature must release the referenced objects and restore them on undo
+model.begin()
+Part_1_doc.removeFeature(objectToFeature(Part_1_doc.objectByName("Features", "Cut_1")))
+model.end()
+checkState(Part_1_doc, aBoxes, [])
+
+model.undo()
+checkState(Part_1_doc, aBoxes, [0, 2])
+model.redo()
+checkState(Part_1_doc, aBoxes, [])
+model.undo()
+
+def groupRefs(theBox):
+  aResult = theBox.feature().firstResult()
+  return [aRef for aRef in aResult.data().refsToMe()
+          if objectToFeature(aRef.owner()).getKind() == "Group"]
+
+# the selection list element refers to the same context as the remaining one: it stays referenced
+model.begin()
+Group_1 = model.addGroup(Part_1_doc, "FACE", [model.selection("FACE", "Box_4_1/Front"),
+                                              model.selection("FACE", "Box_4_1/Top")])
+model.end()
+assert(len(groupRefs(aBoxes[3])) == 1)
+model.begin()
+Group_1.feature().selectionList("group_list").removeLast()
+model.end()
+assert(len(groupRefs(aBoxes[3])) == 1)
+# the context of the selection element is changed: the back reference follows it
+model.begin()
+Group_1.feature().selectionList("group_list").value(0).selectSubShape("FACE", "Box_5_1/Front")
+model.end()
+assert(len(groupRefs(aBoxes[3])) == 0)
+assert(len(groupRefs(aBoxes[4])) == 1)
+model.undo()
+assert(len(groupRefs(aBoxes[3])) == 1)
+assert(len(groupRefs(aBoxes[4])) == 0)
+model.redo()
+assert(len(groupRefs(aBoxes[4])) == 1)
+
+assert(model.checkPythonDump())
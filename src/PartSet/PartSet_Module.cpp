@@ -1767,14 +1767,16 @@ void PartSet_Module::processEvent(const std::shared_ptr<Events_Message>& theMess
     // Update displayed objects in order to update active color
     XGUI_Displayer* aDisplayer = aWorkshop->displayer();
     QObjectPtrList aObjects = aDisplayer->displayedObjects();
+    std::set<ObjectPtr> aToRedisplay;
     bool aHidden;
     foreach(ObjectPtr aObj, aObjects) {
       aHidden = !aObj->data() || !aObj->data()->isValid() ||
         aObj->isDisabled() || (!aObj->isDisplayed());
       if (!aHidden) {
-        aDisplayer->redisplay(aObj, false);
+        aToRedisplay.insert(aObj);
       }
     }
+    aDisplayer->redisplay(aToRedisplay, false);
     aDisplayer->updateViewer();
     // Update tree items if they are expanded
     if (needUpdate) {
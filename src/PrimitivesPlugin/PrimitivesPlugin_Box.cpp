@@ -76,6 +76,59 @@ void PrimitivesPlugin_Box::execute()
     createBoxByOnePointAndDims();
 }
 
+//=================================================================================================
+bool PrimitivesPlugin_Box::prepareArguments()
+{
+  // box by two points depends on the selected vertices, so, it is never prepared in advance
+  myPreparedAlgo.reset();
+  myPreparedMethod = string(PrimitivesPlugin_Box::CREATION_METHOD())->value();
+  if (myPreparedMethod == CREATION_METHOD_BY_DIMENSIONS()) {
+    myPreparedArgs.assign(3, 0.);
+    myPreparedArgs[0] = real(PrimitivesPlugin_Box::DX_ID())->value();
+    myPreparedArgs[1] = real(PrimitivesPlugin_Box::DY_ID())->value();
+    myPreparedArgs[2] = real(PrimitivesPlugin_Box::DZ_ID())->value();
+    return true;
+  } else if (myPreparedMethod == CREATION_METHOD_BY_ONE_POINT_AND_DIMS()) {
+    myPreparedArgs.assign(6, 0.);
+    myPreparedArgs[0] = real(PrimitivesPlugin_Box::OX_ID())->value();
+    myPreparedArgs[1] = real(PrimitivesPlugin_Box::OY_ID())->value();
+    myPreparedArgs[2] = real(PrimitivesPlugin_Box::OZ_ID())->value();
+    myPreparedArgs[3] = real(PrimitivesPlugin_Box::HALF_DX_ID())->value();
+    myPreparedArgs[4] = real(PrimitivesPlugin_Box::HALF_DY_ID())->value();
+    myPreparedArgs[5] = real(PrimitivesPlugin_Box::HALF_DZ_ID())->value();
+    return true;
+  }
+  return false;
+}
+
+//=================================================================================================
+void PrimitivesPlugin_Box::prepareExecution()
+{
+  // called in a worker thread: uses only the copied arguments, errors are reported by execute
+  std::shared_ptr<GeomAlgoAPI_Box> anAlgo;
+  if (myPreparedMethod == CREATION_METHOD_BY_DIMENSIONS() && myPreparedArgs.size() == 3) {
+    anAlgo.reset(new GeomAlgoAPI_Box(myPreparedArgs[0], myPreparedArgs[1], myPreparedArgs[2]));
+  } else if (myPreparedMethod == CREATION_METHOD_BY_ONE_POINT_AND_DIMS() &&
+             myPreparedArgs.size() == 6) {
+    anAlgo.reset(new GeomAlgoAPI_Box(myPreparedArgs[0], myPreparedArgs[1],
+      myPreparedArgs[2], myPreparedArgs[3], myPreparedArgs[4], myPreparedArgs[5]));
+  }
+  if (anAlgo.get() && anAlgo->check())
+    anAlgo->build();
+  myPreparedAlgo = anAlgo;
+}
+
+//=================================================================================================
+std::shared_ptr<GeomAlgoAPI_Box> PrimitivesPlugin_Box::preparedAlgo(
+  const std::string& theMethod, const std::vector<double>& theArgs)
+{
+  std::shared_ptr<GeomAlgoAPI_Box> aResult;
+  if (myPreparedAlgo.get() && myPreparedMethod == theMethod && myPreparedArgs == theArgs)
+    aResult = myPreparedAlgo;
+  myPreparedAlgo.reset();
+  return aResult;
+}
+
 //=================================================================================================
 void PrimitivesPlugin_Box::createBoxByDimensions()
 {
@@ -83,7 +136,12 @@ void PrimitivesPlugin_Box::createBoxByDimensions()
   double aDy = real(PrimitivesPlugin_Box::DY_ID())->value();
   double aDz = real(PrimitivesPlugin_Box::DZ_ID())->value();
 
-  std::shared_ptr<GeomAlgoAPI_Box> aBoxAlgo(new GeomAlgoAPI_Box(aDx,aDy,aDz));
+  std::vector<double> anArgs(3);
+  anArgs[0] = aDx; anArgs[1] = aDy; anArgs[2] = aDz;
+  std::shared_ptr<GeomAlgoAPI_Box> aBoxAlgo =
+    preparedAlgo(CREATION_METHOD_BY_DIMENSIONS(), anArgs);
+  if (!aBoxAlgo.get())
+    aBoxAlgo.reset(new GeomAlgoAPI_Box(aDx,aDy,aDz));
 
   // These checks should be made to the GUI for the feature but
   // the corresponding validator does not exist yet.
@@ -92,8 +150,9 @@ void PrimitivesPlugin_Box::createBoxByDimensions()
     return;
   }
 
-  // Build the box
-  aBoxAlgo->build();
+  // Build the box (if it was not built by prepareExecution)
+  if (!aBoxAlgo->isDone())
+    aBoxAlgo->build();
 
   // Check if the creation of the box
   if(!aBoxAlgo->isDone()) {
@@ -174,8 +233,13 @@ void PrimitivesPlugin_Box::createBoxByOnePointAndDims()
   double y = real(PrimitivesPlugin_Box::OY_ID())->value();
   double z = real(PrimitivesPlugin_Box::OZ_ID())->value();
 
-  std::shared_ptr<GeomAlgoAPI_Box> aBoxAlgo;
-  aBoxAlgo = std::shared_ptr<GeomAlgoAPI_Box>(new GeomAlgoAPI_Box(x,y,z,aDx,aDy,aDz));
+  std::vector<double> anArgs(6);
+  anArgs[0] = x; anArgs[1] = y; anArgs[2] = z;
+  anArgs[3] = aDx; anArgs[4] = aDy; anArgs[5] = aDz;
+  std::shared_ptr<GeomAlgoAPI_Box> aBoxAlgo =
+    preparedAlgo(CREATION_METHOD_BY_ONE_POINT_AND_DIMS(), anArgs);
+  if (!aBoxAlgo.get())
+    aBoxAlgo = std::shared_ptr<GeomAlgoAPI_Box>(new GeomAlgoAPI_Box(x,y,z,aDx,aDy,aDz));
 
   // These checks should be made to the GUI for the feature but
   // the corresponding validator does not exist yet.
@@ -184,8 +248,9 @@ void PrimitivesPlugin_Box::createBoxByOnePointAndDims()
     return;
   }
 
-  // Build the box
-  aBoxAlgo->build();
+  // Build the box (if it was not built by prepareExecution)
+  if (!aBoxAlgo->isDone())
+    aBoxAlgo->build();
 
   // Check if the creation of the box
   if(!aBoxAlgo->isDone()) {
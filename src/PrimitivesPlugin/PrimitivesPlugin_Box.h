@@ -24,6 +24,8 @@
 #include <ModelAPI_Feature.h>
 #include <GeomAlgoAPI_Box.h>
 
+#include <vector>
+
 class GeomAPI_Shape;
 class ModelAPI_ResultBody;
 
@@ -164,6 +166,12 @@ class PrimitivesPlugin_Box : public ModelAPI_Feature
   /// Request for initialization of data model of the feature: adding all attributes
   PRIMITIVESPLUGIN_EXPORT virtual void initAttributes();
 
+  /// Copies the dimensions of the box built by dimensions for the concurrent preparation
+  PRIMITIVESPLUGIN_EXPORT virtual bool prepareArguments();
+
+  /// Builds the box shape for the next execute from the copied dimensions
+  PRIMITIVESPLUGIN_EXPORT virtual void prepareExecution();
+
   /// Use plugin manager for features creation
   PrimitivesPlugin_Box();
 
@@ -181,6 +189,15 @@ class PrimitivesPlugin_Box : public ModelAPI_Feature
   ///Perform the creation of the box using a center and three half-lenths
   void createBoxByOnePointAndDims();
 
+  /// Returns the algorithm built by prepareExecution if it was built with the same
+  /// method and arguments, or null otherwise. In any case the prepared algorithm is released.
+  std::shared_ptr<GeomAlgoAPI_Box> preparedAlgo(const std::string& theMethod,
+                                                const std::vector<double>& theArgs);
+
+  std::shared_ptr<GeomAlgoAPI_Box> myPreparedAlgo; ///< algorithm built by prepareExecution
+  std::string myPreparedMethod; ///< creation method of the prepared algorithm
+  std::vector<double> myPreparedArgs; ///< arguments of the prepared algorithm
+
 };
 
 
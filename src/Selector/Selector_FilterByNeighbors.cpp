@@ -25,6 +25,10 @@
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_Compound.hxx>
 #include <TopTools_MapOfShape.hxx>
+#include <TopTools_DataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TDataStd_Integer.hxx>
 #include <TDataStd_IntegerArray.hxx>
@@ -36,6 +40,65 @@ static const Standard_GUID kLEVELS_ARRAY("ee4c4b45-e859-4e86-aa4f-6eac68e0ca1f")
 Selector_FilterByNeighbors::Selector_FilterByNeighbors() : Selector_AlgoWithSubs()
 {}
 
+/// Adjacency of sub-shapes of the context through the connector sub-shapes (edges of faces
+/// or vertices of edges), computed once for the context instead of exploring it for each search
+struct Selector_NeighborsGraph
+{
+  TopoDS_Shape myContext; ///< the whole shape where neighbors are searched
+  TopAbs_ShapeEnum myValueType; ///< type of neighbor sub-shapes
+  TopAbs_ShapeEnum myConnectorType; ///< type of sub-shapes shared by neighbors
+  TopTools_IndexedDataMapOfShapeListOfShape myValues; ///< connector -> values that contain it
+  TopTools_DataMapOfShapeListOfShape myConnectors; ///< value -> connectors of it
+};
+
+/// Returns the recently used adjacency graphs, the most recently used is the first
+static std::list<Selector_NeighborsGraph>& neighborsGraphs()
+{
+  static std::list<Selector_NeighborsGraph> aGraphs;
+  return aGraphs;
+}
+
+/// Returns the adjacency graph of the context: the recently used graphs are kept, so, all
+/// selections by neighbors in the same context (updated together) use the same graph
+static const Selector_NeighborsGraph& neighborsGraph(const TopoDS_Shape& theContext,
+  const TopAbs_ShapeEnum theValueType, const TopAbs_ShapeEnum theConnectorType)
+{
+  static const size_t kMaxGraphs = 4;
+  std::list<Selector_NeighborsGraph>& aGraphs = neighborsGraphs();
+  std::list<Selector_NeighborsGraph>::iterator aGraph = aGraphs.begin();
+  for(; aGraph != aGraphs.end(); aGraph++) {
+    if (aGraph->myValueType == theValueType && aGraph->myConnectorType == theConnectorType &&
+        aGraph->myContext.IsSame(theContext)) {
+      aGraphs.splice(aGraphs.begin(), aGraphs, aGraph);
+      return aGraphs.front();
+    }
+  }
+  if (aGraphs.size() >= kMaxGraphs)
+    aGraphs.pop_back();
+  aGraphs.push_front(Selector_NeighborsGraph());
+  Selector_NeighborsGraph& aNew = aGraphs.front();
+  aNew.myContext = theContext; // keeps the shape, so, it can not be replaced by another one
+  aNew.myValueType = theValueType;
+  aNew.myConnectorType = theConnectorType;
+  TopExp::MapShapesAndAncestors(theContext, theConnectorType, theValueType, aNew.myValues);
+  for(int anIndex = 1; anIndex <= aNew.myValues.Extent(); anIndex++) {
+    const TopoDS_Shape& aConnector = aNew.myValues.FindKey(anIndex);
+    TopTools_ListIteratorOfListOfShape aValue(aNew.myValues.FindFromIndex(anIndex));
+    for(; aValue.More(); aValue.Next()) {
+      TopTools_ListOfShape* aConnectors = aNew.myConnectors.ChangeSeek(aValue.Value());
+      if (!aConnectors)
+        aConnectors = aNew.myConnectors.Bound(aValue.Value(), TopTools_ListOfShape());
+      aConnectors->Append(aConnector);
+    }
+  }
+  return aNew;
+}
+
+void Selector_FilterByNeighbors::clearCache()
+{
+  neighborsGraphs().clear();
+}
+
 /// Searches neighbor of theLevel of neighborhood to theValue in theContex
 static void findNeighbors(const TopoDS_Shape theContext, const TopoDS_Shape theValue,
   const int theLevel, TopTools_MapOfShape& theResult)
@@ -53,9 +116,15 @@ static void findNeighbors(const TopoDS_Shape theContext, const TopoDS_Shape theV
       aValueType = TopAbs_EDGE;
     }
   }
+  const Selector_NeighborsGraph& aGraph =
+    neighborsGraph(theContext, aValueType, aConnectorType);
+
   TopTools_MapOfShape aNBConnectors; // connector shapes that already belong to neighbors
-  for(TopExp_Explorer aValExp(theValue, aConnectorType); aValExp.More(); aValExp.Next())
-    aNBConnectors.Add(aValExp.Current());
+  TopTools_ListOfShape aLevelConnectors; // connectors of the neighbors of the previous level
+  for(TopExp_Explorer aValExp(theValue, aConnectorType); aValExp.More(); aValExp.Next()) {
+    if (aNBConnectors.Add(aValExp.Current()))
+      aLevelConnectors.Append(aValExp.Current());
+  }
 
   TopTools_MapOfShape alreadyProcessed;
   if (aValueType == theValue.ShapeType())
@@ -64,32 +133,35 @@ static void findNeighbors(const TopoDS_Shape theContext, const TopoDS_Shape theV
     for(TopExp_Explorer aValExp(theValue, aValueType); aValExp.More(); aValExp.Next())
       alreadyProcessed.Add(aValExp.Current());
 
-  for(int aLevel = 1; aLevel <= theLevel; aLevel++) {
+  // breadth-first search: neighbors of the next level share the connectors of the previous level
+  for(int aLevel = 1; aLevel <= theLevel && !aLevelConnectors.IsEmpty(); aLevel++) {
     TopoDS_ListOfShape aGoodCandidates;
-    TopExp_Explorer aCandidate(theContext, aValueType);
-    for(; aCandidate.More(); aCandidate.Next()) {
-      if (alreadyProcessed.Contains(aCandidate.Current()))
+    TopTools_ListIteratorOfListOfShape aConnector(aLevelConnectors);
+    for(; aConnector.More(); aConnector.Next()) {
+      const TopTools_ListOfShape* aCandidates = aGraph.myValues.Seek(aConnector.Value());
+      if (!aCandidates)
         continue;
-      TopExp_Explorer aCandConnector(aCandidate.Current(), aConnectorType);
-      for(; aCandConnector.More(); aCandConnector.Next()) {
-        if (aNBConnectors.Contains(aCandConnector.Current())) // candidate is neighbor
-          break;
-      }
-      if (aCandConnector.More()) {
+      TopTools_ListIteratorOfListOfShape aCandidate(*aCandidates);
+      for(; aCandidate.More(); aCandidate.Next()) {
+        if (!alreadyProcessed.Add(aCandidate.Value()))
+          continue;
         if (aLevel == theLevel) { // add a NB into result: it is connected to other neighbors
-          theResult.Add(aCandidate.Current());
+          theResult.Add(aCandidate.Value());
         } else { // add to the NB of the current level
-          aGoodCandidates.Append(aCandidate.Current());
+          aGoodCandidates.Append(aCandidate.Value());
         }
       }
     }
-    if (aLevel != theLevel) { // good candidates are added to neighbor of this level by connectors
-      for(TopoDS_ListOfShape::Iterator aGood(aGoodCandidates); aGood.More(); aGood.Next()) {
-        TopExp_Explorer aGoodConnector(aGood.Value(), aConnectorType);
-        for(; aGoodConnector.More(); aGoodConnector.Next()) {
-          aNBConnectors.Add(aGoodConnector.Current());
-        }
-        alreadyProcessed.Add(aGood.Value());
+    // good candidates are added to neighbor of this level by connectors
+    aLevelConnectors.Clear();
+    for(TopoDS_ListOfShape::Iterator aGood(aGoodCandidates); aGood.More(); aGood.Next()) {
+      const TopTools_ListOfShape* aGoodConnectors = aGraph.myConnectors.Seek(aGood.Value());
+      if (!aGoodConnectors)
+        continue;
+      TopTools_ListIteratorOfListOfShape aGoodConnector(*aGoodConnectors);
+      for(; aGoodConnector.More(); aGoodConnector.Next()) {
+        if (aNBConnectors.Add(aGoodConnector.Value()))
+          aLevelConnectors.Append(aGoodConnector.Value());
       }
     }
   }
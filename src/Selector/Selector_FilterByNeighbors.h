@@ -57,6 +57,9 @@ public:
 
   /// Returns the naming name of the selection
   SELECTOR_EXPORT virtual std::wstring name(Selector_NameGenerator* theNameGenerator) override;
+
+  /// Releases the adjacency graphs of the recently used contexts (they keep the shapes)
+  SELECTOR_EXPORT static void clearCache();
 private:
   /// Initializes selector
   Selector_FilterByNeighbors();
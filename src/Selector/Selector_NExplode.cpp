@@ -22,6 +22,8 @@
 #include <GeomAPI_Shape.h>
 #include <GeomAlgoAPI_NExplode.h>
 
+#include <list>
+
 ////#include <TopoDS_Shape.hxx>
 ////#include <BRep_Tool.hxx>
 ////#include <TopoDS.hxx>
@@ -47,8 +49,50 @@ static GeomShapePtr convertShape(const TopoDS_Shape& theShape)
   return aNewShape;
 }
 
+/// Sorted sub-shapes of the context
+struct Selector_SortedShapes {
+  TopoDS_Shape myContext; ///< keeps the shape, so, it can not be replaced by another one
+  TopAbs_ShapeEnum myType; ///< type of sub-shapes
+  GeomAlgoAPI_NExplode::ShapeOrder myOrder; ///< kind of sorting
+  std::shared_ptr<GeomAlgoAPI_NExplode> mySorted; ///< sorted sub-shapes
+};
+
+/// Returns the recently used sorted lists, the most recently used is the first
+static std::list<Selector_SortedShapes>& sortedShapesCache()
+{
+  static std::list<Selector_SortedShapes> aCache;
+  return aCache;
+}
+
+/// Returns the sorted sub-shapes of the context. The recently used lists are kept, so, many
+/// weak names in the same context (like in groups) do not sort the same sub-shapes again.
+static std::shared_ptr<GeomAlgoAPI_NExplode> sortedShapes(const TopoDS_Shape& theContext,
+  const TopAbs_ShapeEnum theType, const GeomAlgoAPI_NExplode::ShapeOrder theOrder)
+{
+  static const size_t kMaxSorted = 8;
+  std::list<Selector_SortedShapes>& aCache = sortedShapesCache();
+  std::list<Selector_SortedShapes>::iterator anIter = aCache.begin();
+  for(; anIter != aCache.end(); anIter++) {
+    if (anIter->myType == theType && anIter->myOrder == theOrder &&
+        anIter->myContext.IsEqual(theContext)) {
+      aCache.splice(aCache.begin(), aCache, anIter);
+      return aCache.front().mySorted;
+    }
+  }
+  if (aCache.size() >= kMaxSorted)
+    aCache.pop_back();
+  Selector_SortedShapes aNew;
+  aNew.myContext = theContext;
+  aNew.myType = theType;
+  aNew.myOrder = theOrder;
+  aNew.mySorted = std::make_shared<GeomAlgoAPI_NExplode>(
+    convertShape(theContext), (GeomAPI_Shape::ShapeType)theType, theOrder);
+  aCache.push_front(aNew);
+  return aNew.mySorted;
+}
+
 Selector_NExplode::Selector_NExplode(const TopoDS_ListOfShape& theShapes, const bool theOldOrder)
-  : myToBeReordered(theOldOrder)
+  : myToBeReordered(theOldOrder), myType(TopAbs_SHAPE)
 {
   ListOfShape aShapes;
   for (TopoDS_ListOfShape::Iterator anIt(theShapes); anIt.More(); anIt.Next())
@@ -59,13 +103,16 @@ Selector_NExplode::Selector_NExplode(const TopoDS_ListOfShape& theShapes, const
 
 Selector_NExplode::Selector_NExplode(const TopoDS_Shape& theShape, const TopAbs_ShapeEnum theType,
                                      const bool theOldOrder)
-  : myToBeReordered(theOldOrder)
+  : myToBeReordered(theOldOrder), myContext(theShape), myType(theType)
 {
-  GeomShapePtr aShape = convertShape(theShape);
-  GeomAPI_Shape::ShapeType aType = (GeomAPI_Shape::ShapeType)theType;
-  mySorted = std::make_shared<GeomAlgoAPI_NExplode>(aShape, aType, getOrder(theOldOrder));
+  // the cached list is shared, so, it is never reordered
+  mySorted = sortedShapes(theShape, theType, getOrder(theOldOrder));
 }
 
+void Selector_NExplode::clearCache()
+{
+  sortedShapesCache().clear();
+}
 
 int Selector_NExplode::index(const TopoDS_Shape& theSubShape)
 {
@@ -80,7 +127,12 @@ TopoDS_Shape Selector_NExplode::shape(int& theIndex)
   if (aShape) {
     aResult = aShape->impl<TopoDS_Shape>();
     if (myToBeReordered) {
-      mySorted->reorder(GeomAlgoAPI_NExplode::ORDER_BY_MIDDLE_POINT);
+      if (myContext.IsNull()) {
+        mySorted->reorder(GeomAlgoAPI_NExplode::ORDER_BY_MIDDLE_POINT);
+      } else {
+        mySorted =
+          sortedShapes(myContext, myType, GeomAlgoAPI_NExplode::ORDER_BY_MIDDLE_POINT);
+      }
       theIndex = mySorted->index(aShape);
     }
   }
@@ -50,9 +50,14 @@ class Selector_NExplode
    /// Recompute the index if the old order was used. The value will contain the new ordered index.
    SELECTOR_EXPORT TopoDS_Shape shape(int& theIndex);
 
+   /// Releases the sorted sub-shapes of the recently used contexts (they keep the shapes)
+   SELECTOR_EXPORT static void clearCache();
+
 protected:
   std::shared_ptr<GeomAlgoAPI_NExplode> mySorted; ///< keep the ordered list of shapes
   bool myToBeReordered; ///< the list has to be reordered
+  TopoDS_Shape myContext; ///< context shape if the list is initialized by context
+  TopAbs_ShapeEnum myType; ///< type of sub-shapes of the context
 };
 
 #endif
@@ -0,0 +1,72 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+
+"""
+    Test movement of a point to a position unreachable because of the constraints:
+    the main solver fails, the fallback solvers work on the whole sketch
+    while only the moved part is solved on the first try.
+"""
+
+import math
+from salome.shaper import model
+
+def checkPoint(thePoint, theCoordinates):
+  assert(math.fabs(thePoint.x() - theCoordinates[0]) < 1.e-7), \
+    "Wrong X: {} != {}".format(thePoint.x(), theCoordinates[0])
+  assert(math.fabs(thePoint.y() - theCoordinates[1]) < 1.e-7), \
+    "Wrong Y: {} != {}".format(thePoint.y(), theCoordinates[1])
+
+def lineLength(theLine):
+  return math.hypot(theLine.endPoint().x() - theLine.startPoint().x(),
+                    theLine.endPoint().y() - theLine.startPoint().y())
+
+model.begin()
+partSet = model.moduleDocument()
+Sketch_1 = model.addSketch(partSet, model.defaultPlane("XOY"))
+# the moved part: a line of fixed length with fixed start point
+SketchLine_1 = Sketch_1.addLine(0, 0, 30, 0)
+Sketch_1.setFixed(SketchLine_1.startPoint())
+Sketch_1.setLength(SketchLine_1.result(), 30)
+# a part not connected to the moved one
+SketchLine_2 = Sketch_1.addLine(100, 100, 120, 130)
+SketchLine_3 = Sketch_1.addLine(120, 130, 140, 100)
+Sketch_1.setCoincident(SketchLine_2.endPoint(), SketchLine_3.startPoint())
+Sketch_1.setHorizontal(SketchLine_2.startPoint(), SketchLine_3.endPoint())
+model.do()
+aDOF = model.dof(Sketch_1)
+
+# the point can not be moved so far: the sketch must stay consistent
+for aPos in [[100., 0.], [0., -200.], [-150., 150.]]:
+  Sketch_1.move(SketchLine_1.endPoint(), aPos[0], aPos[1])
+  model.do()
+  checkPoint(SketchLine_1.startPoint(), [0., 0.])
+  assert(math.fabs(lineLength(SketchLine_1) - 30.) < 1.e-7), \
+    "Wrong length: {}".format(lineLength(SketchLine_1))
+  checkPoint(SketchLine_2.startPoint(), [100., 100.])
+  checkPoint(SketchLine_2.endPoint(), [120., 130.])
+  checkPoint(SketchLine_3.startPoint(), [120., 130.])
+  checkPoint(SketchLine_3.endPoint(), [140., 100.])
+  assert(model.dof(Sketch_1) == aDOF)
+
+# reachable position after the failed ones
+Sketch_1.move(SketchLine_1.endPoint(), 0., 30.)
+model.do()
+checkPoint(SketchLine_1.endPoint(), [0., 30.])
+model.end()
+
+assert(model.checkPythonDump())
@@ -0,0 +1,72 @@
+# Copyright (C) 2025  CEA, EDF
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with this library; if not, write to the Free Software
+# Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+#
+# See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+
+"""
+    Test the faces of a large sketch (a grid of 30 x 30 cells) are built
+    and sorted by the indices of the sketch edges bounding them.
+    Faces bounded by the same edges are sorted by the sum of coordinates of their centres.
+"""
+
+import math
+from salome.shaper import model
+from ModelAPI import modelAPI_ResultConstruction
+from GeomAlgoAPI import GeomAlgoAPI_ShapeTools
+
+NB_CELLS = 30
+
+def checkCentre(theFace, theX, theY, theTolerance = 1.e-7):
+  aCentre = GeomAlgoAPI_ShapeTools.centreOfMass(theFace)
+  assert(math.fabs(aCentre.x() - theX) < theTolerance and \
+         math.fabs(aCentre.y() - theY) < theTolerance), \
+    "Wrong face centre: ({}, {}) instead of ({}, {})".format(aCentre.x(), aCentre.y(), theX, theY)
+
+model.begin()
+partSet = model.moduleDocument()
+Sketch_1 = model.addSketch(partSet, model.defaultPlane("XOY"))
+# horizontal lines first, then vertical ones: the edges are indexed in this order
+for i in range(NB_CELLS + 1):
+  Sketch_1.addLine(-1, i, NB_CELLS + 1, i)
+for i in range(NB_CELLS + 1):
+  Sketch_1.addLine(i, -1, i, NB_CELLS + 1)
+model.end()
+
+aResult = modelAPI_ResultConstruction(Sketch_1.feature().firstResult())
+assert(aResult.facesNum() == NB_CELLS * NB_CELLS), \
+  "Wrong number of faces: {}".format(aResult.facesNum())
+# the cells of the lowest row are the first, from left to right
+checkCentre(aResult.face(0), 0.5, 0.5)
+checkCentre(aResult.face(1), 1.5, 0.5)
+checkCentre(aResult.face(NB_CELLS), 0.5, 1.5)
+checkCentre(aResult.face(NB_CELLS * NB_CELLS - 1), NB_CELLS - 0.5, NB_CELLS - 0.5)
+
+# a circle split by its diameter: both halves are bounded by the same edges
+RADIUS = 10
+model.begin()
+Sketch_2 = model.addSketch(partSet, model.defaultPlane("XOY"))
+Sketch_2.addCircle(0, 0, RADIUS)
+Sketch_2.addLine(-RADIUS - 5, 0, RADIUS + 5, 0)
+model.end()
+
+aResult = modelAPI_ResultConstruction(Sketch_2.feature().firstResult())
+assert(aResult.facesNum() == 2), "Wrong number of faces: {}".format(aResult.facesNum())
+# the lower half has the lower sum of coordinates of the centre
+aHalfCentre = 4. * RADIUS / (3. * math.pi)
+checkCentre(aResult.face(0), 0, -aHalfCentre, 1.e-5)
+checkCentre(aResult.face(1), 0, aHalfCentre, 1.e-5)
+
+assert(model.checkPythonDump())
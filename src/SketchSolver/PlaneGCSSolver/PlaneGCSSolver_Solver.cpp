@@ -20,6 +20,9 @@
 #include <PlaneGCSSolver_Solver.h>
 #include <Events_LongOp.h>
 
+#include <map>
+#include <set>
+
 // Multiplier to correlate IDs of SketchPlugin constraint and primitive PlaneGCS constraints
 static const int THE_CONSTRAINT_MULT = 100;
 
@@ -30,7 +33,9 @@ PlaneGCSSolver_Solver::PlaneGCSSolver_Solver()
     myInitilized(false),
     myConfCollected(false),
     myDOF(0),
-    myFictiveConstraint(0)
+    myFictiveConstraint(0),
+    myComponentsValid(false),
+    myPartialSolve(false)
 {
 }
 
@@ -46,6 +51,7 @@ void PlaneGCSSolver_Solver::clear()
   myConstraints.clear();
   myConflictingIDs.clear();
   myDOF = 0;
+  myComponentsValid = false;
 
   removeFictiveConstraint();
 }
@@ -70,6 +76,8 @@ void PlaneGCSSolver_Solver::addConstraint(const ConstraintID& theMultiConstraint
 
   if (theMultiConstraintID >= CID_UNKNOWN)
     myDOF = -1;
+  if (theMultiConstraintID != CID_MOVEMENT)
+    myComponentsValid = false;
   myInitilized = false;
 }
 
@@ -90,6 +98,8 @@ void PlaneGCSSolver_Solver::removeConstraint(const ConstraintID& theID)
   } else if (theID >= CID_UNKNOWN)
     myDOF = -1;
 
+  if (theID != CID_MOVEMENT)
+    myComponentsValid = false;
   myInitilized = false;
 }
 
@@ -97,6 +107,7 @@ double* PlaneGCSSolver_Solver::createParameter()
 {
   double* aResult = new double(0);
   myParameters.push_back(aResult);
+  myComponentsValid = false;
   if (myConstraints.empty() && myDOF >= 0)
     ++myDOF; // calculate DoF by hand if and only if there is no constraints yet
   else
@@ -114,6 +125,7 @@ void PlaneGCSSolver_Solver::addParameters(const GCS::SET_pD& theParams)
       aParams.erase(*anIt);
 
   myParameters.insert(myParameters.end(), aParams.begin(), aParams.end());
+  myComponentsValid = false;
   if (myConstraints.empty() && myDOF >=0)
     myDOF += (int)aParams.size(); // calculate DoF by hand only if there is no constraints yet
   else
@@ -126,6 +138,7 @@ void PlaneGCSSolver_Solver::removeParameters(const GCS::SET_pD& theParams)
     if (theParams.find(myParameters[i]) != theParams.end()) {
       myParameters.erase(myParameters.begin() + i);
       --myDOF;
+      myComponentsValid = false;
     }
   if (!myConstraints.empty())
     myDiagnoseBeforeSolve = true;
@@ -137,13 +150,92 @@ void PlaneGCSSolver_Solver::initialize()
   addFictiveConstraintIfNecessary();
   if (myDiagnoseBeforeSolve)
     diagnose();
-  myEquationSystem->declareUnknowns(myParameters);
+  // while dragging, the parts of the sketch not connected to the moved entity are not changed,
+  // so, the unknowns are the parameters of the moved part only
+  GCS::VEC_pD aMovedParams;
+  if (!myFictiveConstraint)
+    movedComponents(aMovedParams);
+  myPartialSolve = !aMovedParams.empty() && aMovedParams.size() < myParameters.size();
+  myEquationSystem->declareUnknowns(myPartialSolve ? aMovedParams : myParameters);
   myEquationSystem->initSolution();
   Events_LongOp::end(this);
 
   myInitilized = true;
 }
 
+// Representative parameter of the connected part containing the given one (union-find)
+static double* findRoot(std::map<double*, double*>& theParent, double* theParam)
+{
+  std::map<double*, double*>::iterator aFound = theParent.find(theParam);
+  if (aFound == theParent.end()) {
+    theParent[theParam] = theParam;
+    return theParam;
+  }
+  if (aFound->second != theParam)
+    aFound->second = findRoot(theParent, aFound->second);
+  return aFound->second;
+}
+
+void PlaneGCSSolver_Solver::computeComponents()
+{
+  // union-find of parameters connected by constraints
+  std::map<double*, double*> aParent;
+  for (ConstraintMap::iterator anIt = myConstraints.begin(); anIt != myConstraints.end(); ++anIt) {
+    if (anIt->first == CID_MOVEMENT)
+      continue;
+    for (std::list<GCSConstraintPtr>::iterator aCIt = anIt->second.begin();
+         aCIt != anIt->second.end(); ++aCIt) {
+      GCS::VEC_pD aParams = (*aCIt)->params();
+      if (aParams.empty())
+        continue;
+      double* aFirstRoot = findRoot(aParent, aParams.front());
+      for (GCS::VEC_pD::iterator aPIt = aParams.begin() + 1; aPIt != aParams.end(); ++aPIt) {
+        double* aRoot = findRoot(aParent, *aPIt);
+        if (aRoot != aFirstRoot)
+          aParent[aRoot] = aFirstRoot;
+      }
+    }
+  }
+  // enumerate the parts
+  myComponents.clear();
+  std::map<double*, int> aRootIndex;
+  for (GCS::VEC_pD::iterator aPIt = myParameters.begin(); aPIt != myParameters.end(); ++aPIt) {
+    double* aRoot = findRoot(aParent, *aPIt);
+    std::map<double*, int>::iterator aFound = aRootIndex.find(aRoot);
+    if (aFound == aRootIndex.end())
+      aFound = aRootIndex.insert(std::make_pair(aRoot, (int)aRootIndex.size())).first;
+    myComponents[*aPIt] = aFound->second;
+  }
+  myComponentsValid = true;
+}
+
+void PlaneGCSSolver_Solver::movedComponents(GCS::VEC_pD& theParams)
+{
+  ConstraintMap::iterator aMovement = myConstraints.find(CID_MOVEMENT);
+  if (aMovement == myConstraints.end())
+    return;
+  if (!myComponentsValid)
+    computeComponents();
+
+  std::set<int> aMoved;
+  for (std::list<GCSConstraintPtr>::iterator aCIt = aMovement->second.begin();
+       aCIt != aMovement->second.end(); ++aCIt) {
+    GCS::VEC_pD aParams = (*aCIt)->params();
+    for (GCS::VEC_pD::iterator aPIt = aParams.begin(); aPIt != aParams.end(); ++aPIt) {
+      std::map<double*, int>::iterator aFound = myComponents.find(*aPIt);
+      if (aFound != myComponents.end())
+        aMoved.insert(aFound->second);
+    }
+  }
+  if (aMoved.empty())
+    return;
+  for (GCS::VEC_pD::iterator aPIt = myParameters.begin(); aPIt != myParameters.end(); ++aPIt) {
+    std::map<double*, int>::iterator aFound = myComponents.find(*aPIt);
+    if (aFound != myComponents.end() && aMoved.find(aFound->second) != aMoved.end())
+      theParams.push_back(*aPIt);
+  }
+}
+
 PlaneGCSSolver_Solver::SolveStatus PlaneGCSSolver_Solver::solve()
 {
   // clear list of conflicting constraints
@@ -167,6 +259,8 @@ PlaneGCSSolver_Solver::SolveStatus PlaneGCSSolver_Solver::solve()
 
   if (aResult == GCS::Failed) {
     // DogLeg solver failed without conflicting constraints, try to use Levenberg-Marquardt solver
+    // on the whole system: the diagnostic declares all the parameters as unknowns again
+    // (only the moved part of the sketch may be declared while dragging)
     diagnose(GCS::LevenbergMarquardt);
     aResult = (GCS::SolveStatus)myEquationSystem->solve(myParameters, true,
                                                         GCS::LevenbergMarquardt);
@@ -196,6 +290,7 @@ PlaneGCSSolver_Solver::SolveStatus PlaneGCSSolver_Solver::solve()
 
   removeFictiveConstraint();
   myInitilized = false;
+  myPartialSolve = false;
   return aStatus;
 }
 
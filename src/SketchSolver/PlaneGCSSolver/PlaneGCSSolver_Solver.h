@@ -64,6 +64,7 @@ public:
 
   /// \brief Preliminary initialization of solver (useful for moving a feature).
   ///        When called, the solve() method does not reinitialize a set of constraints.
+  ///        Only the connected part of the system containing the moved entity is solved then.
   void initialize();
 
   /// \brief Solve the set of equations
@@ -93,6 +94,12 @@ private:
   /// \brief Remove previously added fictive constraint
   void removeFictiveConstraint();
 
+  /// \brief Collects parameters of the connected parts of the system (without movement)
+  ///        which contain parameters of the movement constraint
+  void movedComponents(GCS::VEC_pD& theParams);
+  /// \brief Splits the parameters to the connected parts by the constraints (without movement)
+  void computeComponents();
+
 private:
   typedef std::map<ConstraintID, std::list<GCSConstraintPtr> > ConstraintMap;
 
@@ -110,6 +117,12 @@ private:
   int                          myDOF;            ///< degrees of freedom
 
   GCS::Constraint*             myFictiveConstraint;
+
+  /// index of the connected part of the system for each parameter, computed by demand
+  /// and kept while the constraints (except the movement) and parameters are not changed
+  std::map<double*, int>       myComponents;
+  bool                         myComponentsValid; ///< myComponents is up to date
+  bool                         myPartialSolve; ///< only the moved part of the system is solved
 };
 
 typedef std::shared_ptr<PlaneGCSSolver_Solver> SolverPtr;
@@ -278,9 +278,9 @@ void SketchSolver_Manager::processEvent(
 
   myIsComputed = false;
 
-  // send update for movement in any case
+  // send update for movement in any case (and the consequences: redisplay)
   if (needToUpdate || isMovedEvt)
-    Events_Loop::loop()->flush(anUpdateEvent);
+    Events_Loop::loop()->flushAll();
 }
 
 // ============================================================================
@@ -349,7 +349,7 @@ bool SketchSolver_Manager::moveFeature(
     if (aPntAttr)
     {
       aPntAttr->setValue(theTo);
-      Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_UPDATED));
+      Events_Loop::loop()->flushAll();
     }
     return true;
   }
@@ -374,7 +374,7 @@ bool SketchSolver_Manager::moveAttribute(
   if (aConstraint)
   {
     setPoint(theMovedAttribute, theMovedPointIndex, theTo);
-    Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_UPDATED));
+    Events_Loop::loop()->flushAll();
     return true;
   }
 
@@ -18,6 +18,8 @@
 //
 // Author : Frederic Pons (OpenCascade)
 
+#include <algorithm>
+
 #include "XAO_BooleanStep.hxx"
 #include "XAO_XaoUtils.hxx"
 
@@ -30,37 +32,20 @@ BooleanStep::BooleanStep(int step, int stamp, int nbElements, int nbComponents)
     m_step = step;
     m_stamp = stamp;
 
-    m_values.reserve(m_nbElements);
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        std::vector<bool> row;
-        row.reserve(m_nbComponents);
-        for (int j = 0; j < m_nbComponents; ++j)
-            row.push_back(false);
-        m_values.push_back(row);
-    }
+    m_values.assign(m_nbElements * m_nbComponents, false);
 }
 
 std::vector<bool> BooleanStep::getValues()
 {
-    std::vector<bool> result;
-    result.reserve(m_nbElements * m_nbComponents);
-
-    std::vector< std::vector<bool>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<bool> eltValues = *it;
-        result.insert(result.end(), eltValues.begin(), eltValues.end());
-    }
-
-    return result;
+    return m_values;
 }
 
 std::vector<bool> BooleanStep::getElement(int element)
 {
     checkElementIndex(element);
 
-    std::vector<bool> result(m_values[element]);
+    std::vector<bool>::const_iterator first = m_values.begin() + element * m_nbComponents;
+    std::vector<bool> result(first, first + m_nbComponents);
     return result;
 }
 
@@ -70,13 +55,8 @@ std::vector<bool> BooleanStep::getComponent(int component)
 
     std::vector<bool> result;
     result.reserve(m_nbElements);
-
-    std::vector< std::vector<bool>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<bool> eltValues = *it;
-        result.push_back(eltValues[component]);
-    }
+    for (int i = 0; i < m_nbElements; ++i)
+        result.push_back(m_values[i * m_nbComponents + component]);
 
     return result;
 }
@@ -86,7 +66,7 @@ bool BooleanStep::getValue(int element, int component)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    return m_values[element][component];
+    return m_values[element * m_nbComponents + component];
 }
 
 const std::string BooleanStep::getStringValue(int element, int component)
@@ -98,13 +78,7 @@ void BooleanStep::setValues(const std::vector<bool>& values)
 {
     checkNbValues((int)values.size());
 
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        for (int j = 0; j < m_nbComponents; ++j)
-        {
-            m_values[i][j] = values[i * m_nbComponents + j];
-        }
-    }
+    m_values.assign(values.begin(), values.end());
 }
 
 void BooleanStep::setElement(int element, const std::vector<bool>& elements)
@@ -112,8 +86,7 @@ void BooleanStep::setElement(int element, const std::vector<bool>& elements)
     checkElementIndex(element);
     checkNbComponents(elements.size());
 
-    for (int i = 0; i < m_nbComponents; ++i)
-        m_values[element][i] = elements[i];
+    std::copy(elements.begin(), elements.end(), m_values.begin() + element * m_nbComponents);
 }
 
 void BooleanStep::setComponent(int component, const std::vector<bool>& components)
@@ -122,7 +95,7 @@ void BooleanStep::setComponent(int component, const std::vector<bool>& component
     checkNbElements(components.size());
 
     for (int i = 0; i < m_nbElements; ++i)
-        m_values[i][component] = components[i];
+        m_values[i * m_nbComponents + component] = components[i];
 }
 
 void BooleanStep::setValue(int element, int component, bool value)
@@ -130,7 +103,7 @@ void BooleanStep::setValue(int element, int component, bool value)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    m_values[element][component] = value;
+    m_values[element * m_nbComponents + component] = value;
 }
 
 void BooleanStep::setStringValue(int element, int component, const std::string& value)
@@ -59,6 +59,14 @@ namespace XAO
          */
         std::vector<bool> getValues();
 
+        /**
+         * Gets all the values of the step without copy.
+         * The values are stored element by element: the value of the component j
+         * of the element i has the index i * countComponents() + j.
+         * @return the values of the step.
+         */
+        const std::vector<bool>& getRawValues() const { return m_values; }
+
         /**
          * Gets all the values for an element.
          * @param element the index of the element to get.
@@ -113,7 +121,8 @@ namespace XAO
         virtual void setStringValue(int element, int component, const std::string& value);
 
     private:
-        std::vector< std::vector<bool> > m_values;
+        /** The values, element by element. */
+        std::vector<bool> m_values;
     };
 }
 
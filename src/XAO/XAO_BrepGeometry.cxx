@@ -62,6 +62,7 @@ void BrepGeometry::setShapeString(const std::string& shape)
     BRep_Builder builder;
     BRepTools::Read(m_shape, streamBrep, builder);
 
+    clearTopology();
     initIds();
 }
 
@@ -79,6 +80,7 @@ void BrepGeometry::readShapeFile(const std::string& fileName)
     if (!res)
         throw XAO_Exception(MsgBuilder() << "Cannot read BRep file: " << fileName);
 
+    clearTopology();
     initIds();
 }
 
@@ -90,9 +92,33 @@ TopoDS_Shape BrepGeometry::getTopoDS_Shape()
 void BrepGeometry::setTopoDS_Shape(const TopoDS_Shape& shape)
 {
     m_shape = shape;
+    clearTopology();
     initIds();
 }
 
+void BrepGeometry::clearTopology()
+{
+    m_allShapes.Clear();
+    for (int type = 0; type < TopAbs_SHAPE; ++type)
+        m_topology[type].Clear();
+}
+
+const TopTools_IndexedMapOfShape& BrepGeometry::getTopology(const TopAbs_ShapeEnum& shapeType)
+{
+    if (shapeType == TopAbs_SHAPE)
+    {
+        if (m_allShapes.IsEmpty() && !m_shape.IsNull())
+            TopExp::MapShapes(m_shape, m_allShapes);
+        return m_allShapes;
+    }
+
+    // same order as the exploration of the shape, without duplicates
+    TopTools_IndexedMapOfShape& subShapes = m_topology[shapeType];
+    if (subShapes.IsEmpty() && !m_shape.IsNull())
+        TopExp::MapShapes(m_shape, shapeType, subShapes);
+    return subShapes;
+}
+
 void BrepGeometry::initIds()
 {
     // initialization of Ids
@@ -104,59 +130,35 @@ void BrepGeometry::initIds()
 
 void BrepGeometry::initListIds(const TopAbs_ShapeEnum& shapeType, GeometricElementList& eltList)
 {
-    TopTools_MapOfShape mapShape;
-    TopTools_ListOfShape listShape;
-
-    int nbElt = 0;
-    TopExp_Explorer exp(m_shape, shapeType);
-    for (; exp.More(); exp.Next())
-    {
-        if (mapShape.Add(exp.Current()))
-        {
-            listShape.Append(exp.Current());
-            nbElt++;
-        }
-    }
-
+    const TopTools_IndexedMapOfShape& listShape = getTopology(shapeType);
     if (listShape.IsEmpty())
         return;
 
-    TopTools_IndexedMapOfShape indices;
-    TopExp::MapShapes(m_shape, indices);
+    const TopTools_IndexedMapOfShape& indices = getTopology(TopAbs_SHAPE);
 
+    int nbElt = listShape.Extent();
     eltList.setSize(nbElt);
-    TopTools_ListIteratorOfListOfShape itSub(listShape);
-    for (int index = 0; itSub.More(); itSub.Next(), ++index)
+    for (int index = 0; index < nbElt; ++index)
     {
-        TopoDS_Shape value = itSub.Value();
-        int ref = indices.FindIndex(value);
+        int ref = indices.FindIndex(listShape(index + 1));
         eltList.setReference(index, XaoUtils::intToString(ref));
     }
 }
 
 TopoDS_Shape BrepGeometry::getSubShape(const TopoDS_Shape& mainShape, const TopAbs_ShapeEnum& shapeType, int shapeIndex)
 {
-    TopTools_MapOfShape mapShape;
-    TopTools_ListOfShape listShape;
-
-    TopExp_Explorer exp(mainShape, shapeType);
-    for (; exp.More(); exp.Next())
+    if (mainShape.IsSame(m_shape))
     {
-        if (mapShape.Add(exp.Current()))
-            listShape.Append(exp.Current());
+        const TopTools_IndexedMapOfShape& listShape = getTopology(shapeType);
+        if (shapeIndex >= 0 && shapeIndex < listShape.Extent())
+            return listShape(shapeIndex + 1);
     }
-
-    if (!listShape.IsEmpty())
+    else
     {
-        TopTools_ListIteratorOfListOfShape itSub(listShape);
-        for (int index = 0; itSub.More(); itSub.Next(), ++index)
-        {
-            if (shapeIndex == index)
-            {
-                TopoDS_Shape value = itSub.Value();
-                return value;
-            }
-        }
+        TopTools_IndexedMapOfShape listShape;
+        TopExp::MapShapes(mainShape, shapeType, listShape);
+        if (shapeIndex >= 0 && shapeIndex < listShape.Extent())
+            return listShape(shapeIndex + 1);
     }
 
     throw XAO_Exception(MsgBuilder() << "Shape with reference [" << shapeIndex << "]  not found.");
@@ -177,27 +179,18 @@ std::vector<int> BrepGeometry::getGeometricalElements(const TopoDS_Shape& shape,
 {
     std::vector<int> indexList;
 
-    TopTools_MapOfShape mapShape;
-    TopTools_ListOfShape listShape;
-
-    TopExp_Explorer exp(shape, shapeType);
-    for (; exp.More(); exp.Next())
-    {
-        if (mapShape.Add(exp.Current()))
-            listShape.Append(exp.Current());
-    }
+    TopTools_IndexedMapOfShape listShape;
+    TopExp::MapShapes(shape, shapeType, listShape);
 
     if (!listShape.IsEmpty())
     {
         // use the shape of the geometry for the indices
-        TopTools_IndexedMapOfShape indices;
-        TopExp::MapShapes(m_shape, indices);
+        const TopTools_IndexedMapOfShape& indices = getTopology(TopAbs_SHAPE);
 
-        TopTools_ListIteratorOfListOfShape itSub(listShape);
-        for (int index = 0; itSub.More(); itSub.Next(), ++index)
+        indexList.reserve(listShape.Extent());
+        for (int index = 1; index <= listShape.Extent(); ++index)
         {
-            TopoDS_Shape value = itSub.Value();
-            int id = indices.FindIndex(value);
+            int id = indices.FindIndex(listShape(index));
             indexList.push_back(findElement(dim, id));
         }
     }
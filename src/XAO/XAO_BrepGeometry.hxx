@@ -25,6 +25,7 @@
 #include <vector>
 
 #include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 #include "XAO.hxx"
 #include "XAO_XaoUtils.hxx"
@@ -320,6 +321,8 @@ namespace XAO
 
     private:
         void initIds();
+        void clearTopology();
+        const TopTools_IndexedMapOfShape& getTopology(const TopAbs_ShapeEnum& shapeType);
         void initListIds(const TopAbs_ShapeEnum& shapeType, GeometricElementList& eltList);
         TopoDS_Shape getSubShape(const TopoDS_Shape& mainShape, const TopAbs_ShapeEnum& shapeType, int shapeIndex)
             ;
@@ -330,6 +333,10 @@ namespace XAO
 
     private:
         TopoDS_Shape m_shape;
+        /** All sub-shapes of the shape, the index is the ID of the sub-shape. Built by demand. */
+        TopTools_IndexedMapOfShape m_allShapes;
+        /** Sub-shapes of the shape by type, in the order of the elements. Built by demand. */
+        TopTools_IndexedMapOfShape m_topology[TopAbs_SHAPE];
     };
 }
 
@@ -18,6 +18,8 @@
 //
 // Author : Frederic Pons (OpenCascade)
 
+#include <algorithm>
+
 #include "XAO_DoubleStep.hxx"
 #include "XAO_XaoUtils.hxx"
 
@@ -30,30 +32,12 @@ DoubleStep::DoubleStep(int step, int stamp, int nbElements, int nbComponents)
     m_step = step;
     m_stamp = stamp;
 
-    m_values.reserve(m_nbElements);
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        std::vector<double> row;
-        row.reserve(m_nbComponents);
-        for (int j = 0; j < m_nbComponents; ++j)
-            row.push_back(0);
-        m_values.push_back(row);
-    }
+    m_values.assign(m_nbElements * m_nbComponents, 0);
 }
 
 std::vector<double> DoubleStep::getValues()
 {
-    std::vector<double> result;
-    result.reserve(m_nbElements * m_nbComponents);
-
-    std::vector< std::vector<double>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<double> eltValues = *it;
-        result.insert(result.end(), eltValues.begin(), eltValues.end());
-    }
-
-    return result;
+    return m_values;
 }
 
 std::vector<double> DoubleStep::getElement(int element)
@@ -61,7 +45,8 @@ std::vector<double> DoubleStep::getElement(int element)
 {
     checkElementIndex(element);
 
-    std::vector<double> result(m_values[element]);
+    std::vector<double>::const_iterator first = m_values.begin() + element * m_nbComponents;
+    std::vector<double> result(first, first + m_nbComponents);
     return result;
 }
 
@@ -72,13 +57,8 @@ std::vector<double> DoubleStep::getComponent(int component)
 
     std::vector<double> result;
     result.reserve(m_nbElements);
-
-    std::vector< std::vector<double>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<double> eltValues = *it;
-        result.push_back(eltValues[component]);
-    }
+    for (int i = 0; i < m_nbElements; ++i)
+        result.push_back(m_values[i * m_nbComponents + component]);
 
     return result;
 }
@@ -89,7 +69,7 @@ double DoubleStep::getValue(int element, int component)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    return m_values[element][component];
+    return m_values[element * m_nbComponents + component];
 }
 
 const std::string DoubleStep::getStringValue(int element, int component)
@@ -103,13 +83,14 @@ void DoubleStep::setValues(const std::vector<double>& values)
 {
     checkNbValues(values.size());
 
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        for (int j = 0; j < m_nbComponents; ++j)
-        {
-            m_values[i][j] = values[i * m_nbComponents + j];
-        }
-    }
+    m_values.assign(values.begin(), values.end());
+}
+
+void DoubleStep::setValues(const double* values, int nbValues)
+{
+    checkNbValues(nbValues);
+
+    m_values.assign(values, values + nbValues);
 }
 
 void DoubleStep::setElement(int element, const std::vector<double>& elements)
@@ -118,8 +99,7 @@ void DoubleStep::setElement(int element, const std::vector<double>& elements)
     checkElementIndex(element);
     checkNbComponents(elements.size());
 
-    for (int i = 0; i < m_nbComponents; ++i)
-        m_values[element][i] = elements[i];
+    std::copy(elements.begin(), elements.end(), m_values.begin() + element * m_nbComponents);
 }
 
 void DoubleStep::setComponent(int component, const std::vector<double>& components)
@@ -129,7 +109,7 @@ void DoubleStep::setComponent(int component, const std::vector<double>& componen
     checkNbElements(components.size());
 
     for (int i = 0; i < m_nbElements; ++i)
-        m_values[i][component] = components[i];
+        m_values[i * m_nbComponents + component] = components[i];
 }
 
 void DoubleStep::setValue(int element, int component, double value)
@@ -138,7 +118,7 @@ void DoubleStep::setValue(int element, int component, double value)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    m_values[element][component] = value;
+    m_values[element * m_nbComponents + component] = value;
 }
 
 void DoubleStep::setStringValue(int element, int component, const std::string& value)
@@ -58,6 +58,14 @@ namespace XAO
          */
         std::vector<double> getValues();
 
+        /**
+         * Gets all the values of the step without copy.
+         * The values are stored element by element: the value of the component j
+         * of the element i has the index i * countComponents() + j.
+         * @return the values of the step.
+         */
+        const std::vector<double>& getRawValues() const { return m_values; }
+
         /**
          * Gets all the values for a given element.
          * @param element the index of the element.
@@ -86,6 +94,13 @@ namespace XAO
          */
         void setValues(const std::vector<double>& values) ;
 
+        /**
+         * Sets all the values from a buffer.
+         * @param values the values, element by element.
+         * @param nbValues the number of values in the buffer.
+         */
+        void setValues(const double* values, int nbValues) ;
+
         /**
          * Sets the values for an element.
          * @param element the index of the element to set.
@@ -112,7 +127,8 @@ namespace XAO
         virtual void setStringValue(int element, int component, const std::string& value) ;
 
     private:
-        std::vector< std::vector<double> > m_values;
+        /** The values, element by element. */
+        std::vector<double> m_values;
     };
 }
 
@@ -59,6 +59,8 @@ void GeometricElementList::setSize(int nb)
 {
     m_count = nb;
     m_elements.clear();
+    m_references.clear();
+    m_dirtyReferences = true;
     for (int i = 0; i < nb; ++i)
     {
         m_elements[i] = GeometricElement();
@@ -78,6 +80,7 @@ void GeometricElementList::setElement(int index, const std::string& name, const
 {
     checkElementIndex(index);
     m_elements[index].setName(name);
+    updateReference(index, m_elements[index].getReference(), reference);
     m_elements[index].setReference(reference);
 }
 
@@ -108,16 +111,43 @@ const std::string GeometricElementList::getReference(int index)
 void GeometricElementList::setReference(int index, const std::string& name)
 {
     checkElementIndex(index);
+    updateReference(index, m_elements[index].getReference(), name);
     m_elements[index].setReference(name);
 }
 
-int GeometricElementList::getIndexByReference(const std::string& ref)
+void GeometricElementList::updateReference(int index, const std::string& oldRef,
+                                           const std::string& newRef)
 {
-    for (int index = 0; index < m_count; ++index)
+    if (m_dirtyReferences || oldRef == newRef)
+        return;
+    std::unordered_map<std::string, int>::iterator found = m_references.find(oldRef);
+    if (found != m_references.end() && found->second == index)
     {
-        if (ref == m_elements[index].getReference())
-            return index;
+        // another element may have the same reference: it is searched on the rebuild
+        m_dirtyReferences = true;
+        return;
     }
+    found = m_references.find(newRef);
+    if (found == m_references.end() || found->second > index)
+        m_references[newRef] = index;
+}
+
+void GeometricElementList::indexReferences()
+{
+    m_references.clear();
+    // keep the first element if a reference is duplicated
+    for (int index = m_count - 1; index >= 0; --index)
+        m_references[m_elements[index].getReference()] = index;
+    m_dirtyReferences = false;
+}
+
+int GeometricElementList::getIndexByReference(const std::string& ref)
+{
+    if (m_dirtyReferences)
+        indexReferences();
+    std::unordered_map<std::string, int>::const_iterator found = m_references.find(ref);
+    if (found != m_references.end())
+        return found->second;
 
     throw XAO_Exception(MsgBuilder() << "Reference not found: " << ref);
 }
@@ -23,6 +23,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 
 #include "XAO.hxx"
 #include "XAO_Exception.hxx"
@@ -187,6 +188,7 @@ namespace XAO
 
         /**
          * Gets the index of an element using its reference.
+         * The references are indexed on the first search, so the search is done in constant time.
          * \param reference the searched reference.
          * \return the index of the element or -1 if no element found.
          */
@@ -199,9 +201,11 @@ namespace XAO
 
         /**
          * Gets an iterator on the first element.
+         * The elements may be modified through the iterator, so the references are indexed again
+         * on the next search.
          * @return an iterator on the first element.
          */
-        iterator begin() { return m_elements.begin(); }
+        iterator begin() { m_dirtyReferences = true; return m_elements.begin(); }
 
         /**
          * Gets an iterator on the last element.
@@ -211,10 +215,17 @@ namespace XAO
 
     private:
         void checkElementIndex(int index) const;
+        void indexReferences();
+        void updateReference(int index, const std::string& oldReference,
+                             const std::string& newReference);
 
     private:
         int m_count;
         std::map<int, GeometricElement> m_elements;
+        /** The index of the first element for each reference, built by demand. */
+        std::unordered_map<std::string, int> m_references;
+        /** True if m_references must be built again before the search. */
+        bool m_dirtyReferences;
     };
 }
 
@@ -18,6 +18,8 @@
 //
 // Author : Frederic Pons (OpenCascade)
 
+#include <algorithm>
+
 #include "XAO_IntegerStep.hxx"
 #include "XAO_XaoUtils.hxx"
 
@@ -30,30 +32,12 @@ IntegerStep::IntegerStep(int step, int stamp, int nbElements, int nbComponents)
     m_step = step;
     m_stamp = stamp;
 
-    m_values.reserve(m_nbElements);
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        std::vector<int> row;
-        row.reserve(m_nbComponents);
-        for (int j = 0; j < m_nbComponents; ++j)
-            row.push_back(0);
-        m_values.push_back(row);
-    }
+    m_values.assign(m_nbElements * m_nbComponents, 0);
 }
 
 std::vector<int> IntegerStep::getValues()
 {
-    std::vector<int> result;
-    result.reserve(m_nbElements * m_nbComponents);
-
-    std::vector< std::vector<int>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<int> eltValues = *it;
-        result.insert(result.end(), eltValues.begin(), eltValues.end());
-    }
-
-    return result;
+    return m_values;
 }
 
 std::vector<int> IntegerStep::getElement(int element)
@@ -61,7 +45,8 @@ std::vector<int> IntegerStep::getElement(int element)
 {
     checkElementIndex(element);
 
-    std::vector<int> result(m_values[element]);
+    std::vector<int>::const_iterator first = m_values.begin() + element * m_nbComponents;
+    std::vector<int> result(first, first + m_nbComponents);
     return result;
 }
 
@@ -72,13 +57,8 @@ std::vector<int> IntegerStep::getComponent(int component)
 
     std::vector<int> result;
     result.reserve(m_nbElements);
-
-    std::vector< std::vector<int>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<int> eltValues = *it;
-        result.push_back(eltValues[component]);
-    }
+    for (int i = 0; i < m_nbElements; ++i)
+        result.push_back(m_values[i * m_nbComponents + component]);
 
     return result;
 }
@@ -89,7 +69,7 @@ int IntegerStep::getValue(int element, int component)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    return m_values[element][component];
+    return m_values[element * m_nbComponents + component];
 }
 
 const std::string IntegerStep::getStringValue(int element, int component)
@@ -103,13 +83,14 @@ void IntegerStep::setValues(const std::vector<int>& values)
 {
     checkNbValues(values.size());
 
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        for (int j = 0; j < m_nbComponents; ++j)
-        {
-            m_values[i][j] = values[i * m_nbComponents + j];
-        }
-    }
+    m_values.assign(values.begin(), values.end());
+}
+
+void IntegerStep::setValues(const int* values, int nbValues)
+{
+    checkNbValues(nbValues);
+
+    m_values.assign(values, values + nbValues);
 }
 
 void IntegerStep::setElement(int element, const std::vector<int>& elements)
@@ -118,8 +99,7 @@ void IntegerStep::setElement(int element, const std::vector<int>& elements)
     checkElementIndex(element);
     checkNbComponents(elements.size());
 
-    for (int i = 0; i < m_nbComponents; ++i)
-        m_values[element][i] = elements[i];
+    std::copy(elements.begin(), elements.end(), m_values.begin() + element * m_nbComponents);
 }
 
 void IntegerStep::setComponent(int component, const std::vector<int>& components)
@@ -129,7 +109,7 @@ void IntegerStep::setComponent(int component, const std::vector<int>& components
     checkNbElements(components.size());
 
     for (int i = 0; i < m_nbElements; ++i)
-        m_values[i][component] = components[i];
+        m_values[i * m_nbComponents + component] = components[i];
 }
 
 void IntegerStep::setValue(int element, int component, int value)
@@ -138,7 +118,7 @@ void IntegerStep::setValue(int element, int component, int value)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    m_values[element][component] = value;
+    m_values[element * m_nbComponents + component] = value;
 }
 
 void IntegerStep::setStringValue(int element, int component, const std::string& value)
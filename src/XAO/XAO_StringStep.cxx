@@ -18,6 +18,8 @@
 //
 // Author : Frederic Pons (OpenCascade)
 
+#include <algorithm>
+
 #include "XAO_StringStep.hxx"
 
 using namespace XAO;
@@ -29,30 +31,12 @@ StringStep::StringStep(int step, int stamp, int nbElements, int nbComponents)
     m_step = step;
     m_stamp = stamp;
 
-    m_values.reserve(m_nbElements);
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        std::vector<std::string> row;
-        row.reserve(m_nbComponents);
-        for (int j = 0; j < m_nbComponents; ++j)
-            row.push_back("");
-        m_values.push_back(row);
-    }
+    m_values.assign(m_nbElements * m_nbComponents, "");
 }
 
 std::vector<std::string> StringStep::getValues()
 {
-    std::vector<std::string> result;
-    result.reserve(m_nbElements * m_nbComponents);
-
-    std::vector< std::vector<std::string>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<std::string> eltValues = *it;
-        result.insert(result.end(), eltValues.begin(), eltValues.end());
-    }
-
-    return result;
+    return m_values;
 }
 
 std::vector<std::string> StringStep::getElement(int element)
@@ -60,7 +44,8 @@ std::vector<std::string> StringStep::getElement(int element)
 {
     checkElementIndex(element);
 
-    std::vector<std::string> result(m_values[element]);
+    std::vector<std::string>::const_iterator first = m_values.begin() + element * m_nbComponents;
+    std::vector<std::string> result(first, first + m_nbComponents);
     return result;
 }
 
@@ -71,13 +56,8 @@ std::vector<std::string> StringStep::getComponent(int component)
 
     std::vector<std::string> result;
     result.reserve(m_nbElements);
-
-    std::vector< std::vector<std::string>  >::iterator it;
-    for (it = m_values.begin(); it != m_values.end(); ++it)
-    {
-        std::vector<std::string> eltValues = *it;
-        result.push_back(eltValues[component]);
-    }
+    for (int i = 0; i < m_nbElements; ++i)
+        result.push_back(m_values[i * m_nbComponents + component]);
 
     return result;
 }
@@ -88,7 +68,7 @@ const std::string StringStep::getValue(int element, int component)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    return m_values[element][component];
+    return m_values[element * m_nbComponents + component];
 }
 
 const std::string StringStep::getStringValue(int element, int component)
@@ -102,13 +82,7 @@ void StringStep::setValues(const std::vector<std::string>& values)
 {
     checkNbValues(values.size());
 
-    for (int i = 0; i < m_nbElements; ++i)
-    {
-        for (int j = 0; j < m_nbComponents; ++j)
-        {
-            m_values[i][j] = values[i * m_nbComponents + j];
-        }
-    }
+    m_values.assign(values.begin(), values.end());
 }
 
 void StringStep::setElement(int element, const std::vector<std::string>& elements)
@@ -117,8 +91,7 @@ void StringStep::setElement(int element, const std::vector<std::string>& element
     checkElementIndex(element);
     checkNbComponents(elements.size());
 
-    for (int i = 0; i < m_nbComponents; ++i)
-        m_values[element][i] = elements[i];
+    std::copy(elements.begin(), elements.end(), m_values.begin() + element * m_nbComponents);
 }
 
 void StringStep::setComponent(int component, const std::vector<std::string>& components)
@@ -128,7 +101,7 @@ void StringStep::setComponent(int component, const std::vector<std::string>& com
     checkNbElements(components.size());
 
     for (int i = 0; i < m_nbElements; ++i)
-        m_values[i][component] = components[i];
+        m_values[i * m_nbComponents + component] = components[i];
 }
 
 void StringStep::setValue(int element, int component, const std::string& value)
@@ -137,7 +110,7 @@ void StringStep::setValue(int element, int component, const std::string& value)
     checkElementIndex(element);
     checkComponentIndex(component);
 
-    m_values[element][component] = value;
+    m_values[element * m_nbComponents + component] = value;
 }
 
 void StringStep::setStringValue(int element, int component, const std::string& value)
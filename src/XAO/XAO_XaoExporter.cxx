@@ -19,6 +19,14 @@
 // Author : Frederic Pons (OpenCascade)
 
 #include <libxml/parser.h>
+#include <libxml/xmlreader.h>
+#include <libxml/xmlwriter.h>
+
+#include <cstring>
+#include <list>
+#include <locale>
+#include <sstream>
+#include <vector>
 
 #include "XAO_XaoExporter.hxx"
 #include "XAO_Xao.hxx"
@@ -26,6 +34,10 @@
 #include "XAO_Group.hxx"
 #include "XAO_Field.hxx"
 #include "XAO_Step.hxx"
+#include "XAO_BooleanStep.hxx"
+#include "XAO_DoubleStep.hxx"
+#include "XAO_IntegerStep.hxx"
+#include "XAO_StringStep.hxx"
 #include "XAO_XaoUtils.hxx"
 
 #ifdef WIN32
@@ -90,43 +102,63 @@ namespace XAO
 using namespace XAO;
 
 namespace {
-    xmlDocPtr exportXMLDoc(Xao* xaoObject, const std::string& shapeFileName);
-    void exportGeometry(Geometry* xaoGeometry, xmlDocPtr doc, xmlNodePtr xao, const std::string& shapeFileName);
-    void exportGeometricElements(Geometry* xaoGeometry, xmlNodePtr topology,
+    /**
+     * Values of a step as read in the file: they are kept typed, without intermediate strings,
+     * and are buffered when the steps are written before the components of the field.
+     */
+    struct StepData
+    {
+        int number;
+        int stamp;
+        std::vector<int> elements;
+        std::vector<int> components;
+        std::vector<double> doubles;   // DOUBLE field
+        std::vector<int> integers;     // INTEGER and BOOLEAN fields
+        std::vector<std::string> strings; // STRING field
+    };
+
+    void exportXML(xmlTextWriterPtr writer, Xao* xaoObject, const std::string& shapeFileName);
+    void exportGeometry(xmlTextWriterPtr writer, Geometry* xaoGeometry, const std::string& shapeFileName);
+    void exportGeometricElements(xmlTextWriterPtr writer, Geometry* xaoGeometry,
                                  XAO::Dimension dim, const xmlChar* colTag, const xmlChar* eltTag);
-    void exportGroups(Xao* xaoObject, xmlNodePtr xao);
-    void exportFields(Xao* xaoObject, xmlNodePtr xao);
-    void exportStep(Step* step, Field* field, xmlNodePtr nodeSteps);
-
-    void parseXMLDoc(xmlDocPtr doc, Xao* xaoObject);
-    void parseXaoNode(xmlDocPtr doc, xmlNodePtr xaoNode, Xao* xaoObject);
-    void parseGeometryNode(xmlDocPtr doc, xmlNodePtr geometryNode, Xao* xaoObject);
-    void parseShapeNode(xmlDocPtr doc, xmlNodePtr shapeNode, Geometry* geometry);
-    void parseTopologyNode(xmlNodePtr topologyNode, Geometry* geometry);
-    void parseVerticesNode(xmlNodePtr verticesNode, Geometry* geometry);
-    void parseEdgesNode(xmlNodePtr edgesNode, Geometry* geometry);
-    void parseFacesNode(xmlNodePtr facesNode, Geometry* geometry);
-    void parseSolidsNode(xmlNodePtr solidsNode, Geometry* geometry);
-    void parseGroupsNode(xmlNodePtr groupsNode, Xao* xaoObject);
-    void parseGroupNode(xmlNodePtr groupNode, Xao* xaoObject);
-
-    void parseFieldsNode(xmlNodePtr fieldsNode, Xao* xaoObject);
-    void parseFieldNode(xmlNodePtr fieldNode, Xao* xaoObject);
-    void parseStepNode(xmlNodePtr stepNode, Field* field);
-    void parseStepElementNode(xmlNodePtr eltNode, Step* step);
-
-    std::string readStringProp(xmlNodePtr node, const xmlChar* attribute,
+    void exportGroups(xmlTextWriterPtr writer, Xao* xaoObject);
+    void exportFields(xmlTextWriterPtr writer, Xao* xaoObject);
+    void exportStep(xmlTextWriterPtr writer, Step* step, Field* field);
+
+    void parseXML(xmlTextReaderPtr reader, Xao* xaoObject);
+    void parseXaoNode(xmlTextReaderPtr reader, Xao* xaoObject);
+    void parseGeometryNode(xmlTextReaderPtr reader, Xao* xaoObject);
+    Geometry* parseShapeNode(xmlTextReaderPtr reader, const std::string& name);
+    void parseTopologyNode(xmlTextReaderPtr reader, Geometry* geometry);
+    void parseElementsNode(xmlTextReaderPtr reader, Geometry* geometry,
+                           XAO::Dimension dim, const xmlChar* eltTag);
+    void parseGroupsNode(xmlTextReaderPtr reader, Xao* xaoObject);
+    void parseGroupNode(xmlTextReaderPtr reader, Xao* xaoObject);
+
+    void parseFieldsNode(xmlTextReaderPtr reader, Xao* xaoObject);
+    void parseFieldNode(xmlTextReaderPtr reader, Xao* xaoObject);
+    void parseStepNode(xmlTextReaderPtr reader, XAO::Type type, StepData& data);
+    void parseStepElementNode(xmlTextReaderPtr reader, XAO::Type type, StepData& data);
+    void applyStep(Field* field, const StepData& data);
+
+    bool readNextChild(xmlTextReaderPtr reader, int parentDepth);
+    bool isNode(xmlTextReaderPtr reader, const xmlChar* tag);
+    std::string readStringProp(xmlTextReaderPtr reader, const xmlChar* attribute,
                                bool required, const std::string& defaultValue,
                                const std::string& exception = std::string(""));
-    int readIntegerProp(xmlNodePtr node, const xmlChar* attribute,
+    int readIntegerProp(xmlTextReaderPtr reader, const xmlChar* attribute,
                         bool required, int defaultValue,
                         const std::string& exception = std::string(""));
 
-    std::string readStringProp(xmlNodePtr node, const xmlChar* attribute,
+    void checkWrite(int result);
+    void writeStringProp(xmlTextWriterPtr writer, const xmlChar* attribute, const std::string& value);
+    void writeIntegerProp(xmlTextWriterPtr writer, const xmlChar* attribute, int value);
+
+    std::string readStringProp(xmlTextReaderPtr reader, const xmlChar* attribute,
                                bool required, const std::string& defaultValue,
                                const std::string& exception /*= std::string() */)
   {
-    xmlChar* strAttr = xmlGetProp(node, attribute);
+    xmlChar* strAttr = xmlTextReaderGetAttribute(reader, attribute);
     if (strAttr == NULL)
     {
         if (required)
@@ -134,7 +166,7 @@ namespace {
             if (exception.size() > 0)
                 throw XAO_Exception(exception.c_str());
 
-            throw XAO_Exception(MsgBuilder() << "Line " << node->line << ": "
+            throw XAO_Exception(MsgBuilder() << "Line " << xmlTextReaderGetParserLineNumber(reader) << ": "
                                              << "Property " << (char*)attribute << " is required.");
         }
 
@@ -146,11 +178,11 @@ namespace {
     return res;
   }
 
-  int readIntegerProp(xmlNodePtr node, const xmlChar* attribute,
+  int readIntegerProp(xmlTextReaderPtr reader, const xmlChar* attribute,
                       bool required, int defaultValue,
                       const std::string& exception /*= std::string() */)
   {
-    xmlChar* strAttr = xmlGetProp(node, attribute);
+    xmlChar* strAttr = xmlTextReaderGetAttribute(reader, attribute);
     if (strAttr == NULL)
     {
         if (required)
@@ -158,7 +190,7 @@ namespace {
             if (exception.size() > 0)
                 throw XAO_Exception(exception.c_str());
 
-            throw XAO_Exception(MsgBuilder() << "Line " << node->line << ": "
+            throw XAO_Exception(MsgBuilder() << "Line " << xmlTextReaderGetParserLineNumber(reader) << ": "
                                              << "Property " << (char*)attribute << " is required.");
         }
 
@@ -170,219 +202,316 @@ namespace {
     return res;
   }
 
-  xmlDocPtr exportXMLDoc(Xao* xaoObject, const std::string& shapeFileName)
+  /**
+   * Moves the reader to the next child element of the current node.
+   * The reader must be on the start of the parent element, or on a previous child.
+   * The descendants of the children are skipped.
+   * @param reader the reader.
+   * @param parentDepth the depth of the parent element.
+   * @return false when the end of the parent element is reached.
+   */
+  bool readNextChild(xmlTextReaderPtr reader, int parentDepth)
+  {
+    int res;
+    while ((res = xmlTextReaderRead(reader)) == 1)
+    {
+        int depth = xmlTextReaderDepth(reader);
+        if (depth <= parentDepth)
+            return false;
+        if (depth == parentDepth + 1 && xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT)
+            return true;
+    }
+
+    if (res < 0)
+        throw XAO_Exception(MsgBuilder() << "Cannot read XAO file: invalid XML at line "
+                                         << xmlTextReaderGetParserLineNumber(reader));
+    return false;
+  }
+
+  bool isNode(xmlTextReaderPtr reader, const xmlChar* tag)
+  {
+    return xmlStrcmp(xmlTextReaderConstLocalName(reader), tag) == 0;
+  }
+
+  void checkWrite(int result)
+  {
+    if (result < 0)
+        throw XAO_Exception("Cannot write XAO file");
+  }
+
+  void writeStringProp(xmlTextWriterPtr writer, const xmlChar* attribute, const std::string& value)
+  {
+    checkWrite(xmlTextWriterWriteAttribute(writer, attribute, BAD_CAST value.c_str()));
+  }
+
+  void writeIntegerProp(xmlTextWriterPtr writer, const xmlChar* attribute, int value)
+  {
+    checkWrite(xmlTextWriterWriteFormatAttribute(writer, attribute, "%d", value));
+  }
+
+  void exportXML(xmlTextWriterPtr writer, Xao* xaoObject, const std::string& shapeFileName)
   {
-    // Creating the Xml document
-    xmlDocPtr masterDocument = xmlNewDoc(BAD_CAST "1.0");
-    xmlNodePtr xao = xmlNewNode(0, C_TAG_XAO);
-    xmlDocSetRootElement(masterDocument, xao);
+    // same layout as a saved DOM: node indentation with two spaces
+    xmlTextWriterSetIndent(writer, 1);
+    xmlTextWriterSetIndentString(writer, BAD_CAST "  ");
 
-    xmlNewProp(xao, C_ATTR_XAO_VERSION, BAD_CAST xaoObject->getVersion().c_str());
-    xmlNewProp(xao, C_ATTR_XAO_AUTHOR, BAD_CAST xaoObject->getAuthor().c_str());
+    checkWrite(xmlTextWriterStartDocument(writer, "1.0", "UTF-8", NULL));
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_XAO));
+    writeStringProp(writer, C_ATTR_XAO_VERSION, xaoObject->getVersion());
+    writeStringProp(writer, C_ATTR_XAO_AUTHOR, xaoObject->getAuthor());
 
     if (xaoObject->getGeometry() != NULL)
     {
-        exportGeometry(xaoObject->getGeometry(), masterDocument, xao, shapeFileName);
+        exportGeometry(writer, xaoObject->getGeometry(), shapeFileName);
     }
 
-    exportGroups(xaoObject, xao);
-    exportFields(xaoObject, xao);
+    exportGroups(writer, xaoObject);
+    exportFields(writer, xaoObject);
 
-    return masterDocument;
+    checkWrite(xmlTextWriterEndElement(writer));
+    checkWrite(xmlTextWriterEndDocument(writer));
   }
 
-  void exportGeometricElements(Geometry* xaoGeometry,
-                               xmlNodePtr topology, XAO::Dimension dim, const xmlChar* colTag, const xmlChar* eltTag)
+  void exportGeometricElements(xmlTextWriterPtr writer, Geometry* xaoGeometry,
+                               XAO::Dimension dim, const xmlChar* colTag, const xmlChar* eltTag)
   {
-    xmlNodePtr vertices = xmlNewChild(topology, 0, colTag, 0);
-    xmlNewProp(vertices, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(xaoGeometry->countElements(dim)).c_str());
+    checkWrite(xmlTextWriterStartElement(writer, colTag));
+    writeIntegerProp(writer, C_ATTR_COUNT, xaoGeometry->countElements(dim));
     GeometricElementList::iterator it = xaoGeometry->begin(dim);
     for (; it != xaoGeometry->end(dim); it++)
     {
-        int index = it->first;
-        GeometricElement elt = it->second;
-        xmlNodePtr vertex = xmlNewChild(vertices, 0, eltTag, 0);
-        xmlNewProp(vertex, C_ATTR_ELT_INDEX, BAD_CAST XaoUtils::intToString(index).c_str());
-        xmlNewProp(vertex, C_ATTR_ELT_NAME, BAD_CAST elt.getName().c_str());
-        xmlNewProp(vertex, C_ATTR_ELT_REFERENCE, BAD_CAST elt.getReference().c_str());
+        GeometricElement& elt = it->second;
+        checkWrite(xmlTextWriterStartElement(writer, eltTag));
+        writeIntegerProp(writer, C_ATTR_ELT_INDEX, it->first);
+        writeStringProp(writer, C_ATTR_ELT_NAME, elt.getName());
+        writeStringProp(writer, C_ATTR_ELT_REFERENCE, elt.getReference());
+        checkWrite(xmlTextWriterEndElement(writer));
     }
+    checkWrite(xmlTextWriterEndElement(writer));
   }
 
-  void exportGeometry(Geometry* xaoGeometry, xmlDocPtr doc, xmlNodePtr xao,
-                      const std::string& shapeFileName)
+  void exportGeometry(xmlTextWriterPtr writer, Geometry* xaoGeometry, const std::string& shapeFileName)
   {
     // Geometric part
-    xmlNodePtr geometry = xmlNewChild(xao, 0, C_TAG_GEOMETRY, 0);
-    xmlNewProp(geometry, C_ATTR_GEOMETRY_NAME, BAD_CAST xaoGeometry->getName().c_str());
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_GEOMETRY));
+    writeStringProp(writer, C_ATTR_GEOMETRY_NAME, xaoGeometry->getName());
 
-    xmlNodePtr shape = xmlNewChild(geometry, 0, C_TAG_SHAPE, 0);
-    xmlNewProp(shape, C_ATTR_SHAPE_FORMAT, BAD_CAST XaoUtils::shapeFormatToString(xaoGeometry->getFormat()).c_str());
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_SHAPE));
+    writeStringProp(writer, C_ATTR_SHAPE_FORMAT, XaoUtils::shapeFormatToString(xaoGeometry->getFormat()));
 
     if (shapeFileName == "")
     {
         // export the shape in the XAO file
         std::string txtShape = xaoGeometry->getShapeString();
-        xmlNodePtr cdata = xmlNewCDataBlock(doc, BAD_CAST txtShape.c_str(), txtShape.size());
-        xmlAddChild(shape, cdata);
+        checkWrite(xmlTextWriterWriteCDATA(writer, BAD_CAST txtShape.c_str()));
     }
     else
     {
         // export the shape in an external file
-        xmlNewProp(shape, C_ATTR_SHAPE_FILE, BAD_CAST shapeFileName.c_str());
+        writeStringProp(writer, C_ATTR_SHAPE_FILE, shapeFileName);
         xaoGeometry->writeShapeFile(shapeFileName);
     }
+    checkWrite(xmlTextWriterEndElement(writer));
 
-    xmlNodePtr topology = xmlNewChild(geometry, 0, C_TAG_TOPOLOGY, 0);
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_TOPOLOGY));
+    exportGeometricElements(writer, xaoGeometry, XAO::VERTEX, C_TAG_VERTICES, C_TAG_VERTEX);
+    exportGeometricElements(writer, xaoGeometry, XAO::EDGE, C_TAG_EDGES, C_TAG_EDGE);
+    exportGeometricElements(writer, xaoGeometry, XAO::FACE, C_TAG_FACES, C_TAG_FACE);
+    exportGeometricElements(writer, xaoGeometry, XAO::SOLID, C_TAG_SOLIDS, C_TAG_SOLID);
+    checkWrite(xmlTextWriterEndElement(writer));
 
-    exportGeometricElements(xaoGeometry, topology, XAO::VERTEX, C_TAG_VERTICES, C_TAG_VERTEX);
-    exportGeometricElements(xaoGeometry, topology, XAO::EDGE, C_TAG_EDGES, C_TAG_EDGE);
-    exportGeometricElements(xaoGeometry, topology, XAO::FACE, C_TAG_FACES, C_TAG_FACE);
-    exportGeometricElements(xaoGeometry, topology, XAO::SOLID, C_TAG_SOLIDS, C_TAG_SOLID);
+    checkWrite(xmlTextWriterEndElement(writer));
   }
 
-  void exportGroups(Xao* xaoObject, xmlNodePtr xao)
+  void exportGroups(xmlTextWriterPtr writer, Xao* xaoObject)
   {
-    xmlNodePtr groups = xmlNewChild(xao, 0, C_TAG_GROUPS, 0);
-    xmlNewProp(groups, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(xaoObject->countGroups()).c_str());
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_GROUPS));
+    writeIntegerProp(writer, C_ATTR_COUNT, xaoObject->countGroups());
 
     for (int i = 0; i < xaoObject->countGroups(); i++)
     {
-        //Group* grp = (*it);
         Group* grp = xaoObject->getGroup(i);
-        xmlNodePtr group = xmlNewChild(groups, 0, C_TAG_GROUP, 0);
-        xmlNewProp(group, C_ATTR_GROUP_NAME, BAD_CAST grp->getName().c_str());
-        xmlNewProp(group, C_ATTR_GROUP_DIM, BAD_CAST XaoUtils::dimensionToString(grp->getDimension()).c_str());
-        xmlNewProp(group, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(grp->count()).c_str());
+        checkWrite(xmlTextWriterStartElement(writer, C_TAG_GROUP));
+        writeStringProp(writer, C_ATTR_GROUP_NAME, grp->getName());
+        writeStringProp(writer, C_ATTR_GROUP_DIM, XaoUtils::dimensionToString(grp->getDimension()));
+        writeIntegerProp(writer, C_ATTR_COUNT, grp->count());
 
         for (std::set<int>::iterator it = grp->begin(); it != grp->end(); ++it)
         {
-            int grpElt = (*it);
-            xmlNodePtr elt = xmlNewChild(group, 0, C_TAG_ELEMENT, 0);
-            xmlNewProp(elt, C_ATTR_ELEMENT_INDEX, BAD_CAST XaoUtils::intToString(grpElt).c_str());
+            checkWrite(xmlTextWriterStartElement(writer, C_TAG_ELEMENT));
+            writeIntegerProp(writer, C_ATTR_ELEMENT_INDEX, *it);
+            checkWrite(xmlTextWriterEndElement(writer));
         }
+        checkWrite(xmlTextWriterEndElement(writer));
     }
+    checkWrite(xmlTextWriterEndElement(writer));
   }
 
-  void exportFields(Xao* xaoObject, xmlNodePtr xao)
+  void exportFields(xmlTextWriterPtr writer, Xao* xaoObject)
   {
-    xmlNodePtr fields = xmlNewChild(xao, 0, C_TAG_FIELDS, 0);
-    xmlNewProp(fields, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(xaoObject->countFields()).c_str());
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_FIELDS));
+    writeIntegerProp(writer, C_ATTR_COUNT, xaoObject->countFields());
 
     for (int i = 0; i < xaoObject->countFields(); i++)
     {
         Field* field = xaoObject->getField(i);
-        xmlNodePtr nodeField = xmlNewChild(fields, 0, C_TAG_FIELD, 0);
-        xmlNewProp(nodeField, C_ATTR_FIELD_NAME, BAD_CAST field->getName().c_str());
-        xmlNewProp(nodeField, C_ATTR_FIELD_TYPE, BAD_CAST XaoUtils::fieldTypeToString(field->getType()).c_str());
-        xmlNewProp(nodeField, C_ATTR_FIELD_DIMENSION, BAD_CAST XaoUtils::dimensionToString(field->getDimension()).c_str());
+        checkWrite(xmlTextWriterStartElement(writer, C_TAG_FIELD));
+        writeStringProp(writer, C_ATTR_FIELD_NAME, field->getName());
+        writeStringProp(writer, C_ATTR_FIELD_TYPE, XaoUtils::fieldTypeToString(field->getType()));
+        writeStringProp(writer, C_ATTR_FIELD_DIMENSION, XaoUtils::dimensionToString(field->getDimension()));
 
         int nbComponents = field->countComponents();
-        xmlNodePtr components = xmlNewChild(nodeField, 0, C_TAG_COMPONENTS, 0);
-        xmlNewProp(components, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(nbComponents).c_str());
+        checkWrite(xmlTextWriterStartElement(writer, C_TAG_COMPONENTS));
+        writeIntegerProp(writer, C_ATTR_COUNT, nbComponents);
 
         for (int j = 0; j < nbComponents; j++)
         {
-            xmlNodePtr nodeComponent = xmlNewChild(components, 0, C_TAG_COMPONENT, 0);
-            xmlNewProp(nodeComponent, C_ATTR_COMPONENT_COLUMN, BAD_CAST XaoUtils::intToString(j).c_str());
-            xmlNewProp(nodeComponent, C_ATTR_COMPONENT_NAME, BAD_CAST field->getComponentName(j).c_str());
+            checkWrite(xmlTextWriterStartElement(writer, C_TAG_COMPONENT));
+            writeIntegerProp(writer, C_ATTR_COMPONENT_COLUMN, j);
+            writeStringProp(writer, C_ATTR_COMPONENT_NAME, field->getComponentName(j));
+            checkWrite(xmlTextWriterEndElement(writer));
         }
+        checkWrite(xmlTextWriterEndElement(writer));
 
         int nbSteps = field->countSteps();
-        xmlNodePtr nodeSteps = xmlNewChild(nodeField, 0, C_TAG_STEPS, 0);
-        xmlNewProp(nodeSteps, C_ATTR_COUNT, BAD_CAST XaoUtils::intToString(nbSteps).c_str());
+        checkWrite(xmlTextWriterStartElement(writer, C_TAG_STEPS));
+        writeIntegerProp(writer, C_ATTR_COUNT, nbSteps);
         for (stepIterator itStep = field->begin(); itStep != field->end(); itStep++)
         {
             Step* step = *itStep;
-            exportStep(step, field, nodeSteps);
+            exportStep(writer, step, field);
         }
+        checkWrite(xmlTextWriterEndElement(writer));
+
+        checkWrite(xmlTextWriterEndElement(writer));
     }
+    checkWrite(xmlTextWriterEndElement(writer));
   }
 
-  void exportStep(Step* step, Field* /*field*/, xmlNodePtr nodeSteps)
+  void exportStep(xmlTextWriterPtr writer, Step* step, Field* /*field*/)
   {
-    xmlNodePtr nodeStep = xmlNewChild(nodeSteps, 0, C_TAG_STEP, 0);
-    xmlNewProp(nodeStep, C_ATTR_STEP_NUMBER, BAD_CAST XaoUtils::intToString(step->getStep()).c_str());
+    checkWrite(xmlTextWriterStartElement(writer, C_TAG_STEP));
+    writeIntegerProp(writer, C_ATTR_STEP_NUMBER, step->getStep());
     if (step->getStamp() >= 0)
     {
-        xmlNewProp(nodeStep, C_ATTR_STEP_STAMP, BAD_CAST XaoUtils::intToString(step->getStamp()).c_str());
+        writeIntegerProp(writer, C_ATTR_STEP_STAMP, step->getStamp());
     }
 
+    // numbers are formatted as XaoUtils does, but in the classic locale: the decimal separator
+    // must not depend on LC_NUMERIC of the application; the stream is reused for all values
+    std::ostringstream str;
+    str.imbue(std::locale::classic());
     for(int i = 0; i < step->countElements(); ++i)
     {
-        xmlNodePtr nodeElt = xmlNewChild(nodeStep, 0, C_TAG_ELEMENT, 0);
-        xmlNewProp(nodeElt, C_ATTR_ELEMENT_INDEX, BAD_CAST XaoUtils::intToString(i).c_str());
+        checkWrite(xmlTextWriterStartElement(writer, C_TAG_ELEMENT));
+        writeIntegerProp(writer, C_ATTR_ELEMENT_INDEX, i);
 
         for (int j = 0; j < step->countComponents(); ++j)
         {
-            std::string content = step->getStringValue(i, j);
-            xmlNodePtr nodeValue = xmlNewChild(nodeElt, NULL, C_TAG_VALUE, BAD_CAST content.c_str());
-            xmlNewProp(nodeValue, C_ATTR_VALUE_COMPONENT, BAD_CAST XaoUtils::intToString(j).c_str());
+            checkWrite(xmlTextWriterStartElement(writer, C_TAG_VALUE));
+            writeIntegerProp(writer, C_ATTR_VALUE_COMPONENT, j);
+            switch (step->getType())
+            {
+            case XAO::DOUBLE:
+                str.str("");
+                str << ((DoubleStep*)step)->getValue(i, j);
+                checkWrite(xmlTextWriterWriteString(writer, BAD_CAST str.str().c_str()));
+                break;
+            case XAO::INTEGER:
+                str.str("");
+                str << ((IntegerStep*)step)->getValue(i, j);
+                checkWrite(xmlTextWriterWriteString(writer, BAD_CAST str.str().c_str()));
+                break;
+            case XAO::BOOLEAN:
+                checkWrite(xmlTextWriterWriteString(writer,
+                    BAD_CAST (((BooleanStep*)step)->getValue(i, j) ? "true" : "false")));
+                break;
+            default:
+                checkWrite(xmlTextWriterWriteString(writer,
+                    BAD_CAST ((StringStep*)step)->getValue(i, j).c_str()));
+                break;
+            }
+            checkWrite(xmlTextWriterEndElement(writer));
         }
+        checkWrite(xmlTextWriterEndElement(writer));
     }
+    checkWrite(xmlTextWriterEndElement(writer));
   }
 
-  void parseXMLDoc(xmlDocPtr doc, Xao* xaoObject)
+  void parseXML(xmlTextReaderPtr reader, Xao* xaoObject)
   {
     // Get the root element node
-    xmlNodePtr root = xmlDocGetRootElement(doc);
-    if (xmlStrcmp(root->name , C_TAG_XAO) != 0)
+    if (!readNextChild(reader, -1) || !isNode(reader, C_TAG_XAO))
         throw XAO_Exception("Cannot read XAO file: invalid format XAO node not found");
 
-    parseXaoNode(doc, root, xaoObject);
-
-    xmlFreeDoc(doc);       // free document
-    //xmlCleanupParser();    // free globals //vsr: xmlCleanupParser should not be called from the application
+    parseXaoNode(reader, xaoObject);
   }
 
-  void parseXaoNode(xmlDocPtr doc, xmlNodePtr xaoNode, Xao* xaoObject)
+  void parseXaoNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    std::string version = readStringProp(xaoNode, C_ATTR_XAO_VERSION, false, "");
+    std::string version = readStringProp(reader, C_ATTR_XAO_VERSION, false, "");
     if (version != "")
         xaoObject->setVersion(version);
 
-    std::string author = readStringProp(xaoNode, C_ATTR_XAO_AUTHOR, false, "");
+    std::string author = readStringProp(reader, C_ATTR_XAO_AUTHOR, false, "");
     xaoObject->setAuthor(author);
 
-    for (xmlNodePtr node = xaoNode->children; node; node = node->next)
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
+
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_GEOMETRY) == 0)
-            parseGeometryNode(doc, node, xaoObject);
-        else if (xmlStrcmp(node->name, C_TAG_GROUPS) == 0)
-            parseGroupsNode(node, xaoObject);
-        else if (xmlStrcmp(node->name, C_TAG_FIELDS) == 0)
-            parseFieldsNode(node, xaoObject);
+        if (isNode(reader, C_TAG_GEOMETRY))
+            parseGeometryNode(reader, xaoObject);
+        else if (isNode(reader, C_TAG_GROUPS))
+            parseGroupsNode(reader, xaoObject);
+        else if (isNode(reader, C_TAG_FIELDS))
+            parseFieldsNode(reader, xaoObject);
     }
   }
 
-  void parseGeometryNode(xmlDocPtr doc, xmlNodePtr geometryNode, Xao* xaoObject)
+  void parseGeometryNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    // get the shape and topo nodes
-    xmlNodePtr shapeNode = NULL;
-    xmlNodePtr topoNode = NULL;
-    for (xmlNodePtr node = geometryNode->children; node; node = node->next)
+    std::string name = readStringProp(reader, C_ATTR_GEOMETRY_NAME, false, "");
+    int line = xmlTextReaderGetParserLineNumber(reader);
+
+    // the shape is written before the topology, which needs the created geometry
+    Geometry* geometry = NULL;
+    if (!xmlTextReaderIsEmptyElement(reader))
     {
-        if (xmlStrcmp(node->name, C_TAG_SHAPE) == 0)
-            shapeNode = node;
-        else if (xmlStrcmp(node->name, C_TAG_TOPOLOGY) == 0)
-            topoNode = node;
+        int depth = xmlTextReaderDepth(reader);
+        while (readNextChild(reader, depth))
+        {
+            if (isNode(reader, C_TAG_SHAPE) && geometry == NULL)
+            {
+                geometry = parseShapeNode(reader, name);
+            }
+            else if (isNode(reader, C_TAG_TOPOLOGY))
+            {
+                if (geometry == NULL)
+                    throw XAO_Exception(MsgBuilder() << "Line " << xmlTextReaderGetParserLineNumber(reader)
+                                                     << ": " << "Topology is defined before the shape.");
+                parseTopologyNode(reader, geometry);
+            }
+        }
     }
 
-    std::string name = readStringProp(geometryNode, C_ATTR_GEOMETRY_NAME, false, "");
-    std::string strFormat = readStringProp(shapeNode, C_ATTR_SHAPE_FORMAT, true, "");
-    XAO::Format shapeFormat = XaoUtils::stringToShapeFormat(strFormat);
-    Geometry* geometry = Geometry::createGeometry(shapeFormat, name);
-
-    parseShapeNode(doc, shapeNode, geometry);
-    parseTopologyNode(topoNode, geometry);
+    if (geometry == NULL)
+        throw XAO_Exception(MsgBuilder() << "Line " << line << ": " << "No shape defined for geometry.");
 
     xaoObject->setGeometry(geometry);
   }
 
-  void parseShapeNode(xmlDocPtr /*doc*/, xmlNodePtr shapeNode, Geometry* geometry)
+  Geometry* parseShapeNode(xmlTextReaderPtr reader, const std::string& name)
   {
+    std::string strFormat = readStringProp(reader, C_ATTR_SHAPE_FORMAT, true, "");
+    XAO::Format shapeFormat = XaoUtils::stringToShapeFormat(strFormat);
+    Geometry* geometry = Geometry::createGeometry(shapeFormat, name);
+
     if (geometry->getFormat() == XAO::BREP)
     {
-        std::string strFile = readStringProp(shapeNode, C_ATTR_SHAPE_FILE, false, "");
+        std::string strFile = readStringProp(reader, C_ATTR_SHAPE_FILE, false, "");
         if (strFile != "")
         {
             geometry->readShapeFile(strFile);
@@ -390,260 +519,362 @@ namespace {
         else
         {
             // read brep from node content
-            xmlChar* data = xmlNodeGetContent(shapeNode->children);
+            xmlChar* data = xmlTextReaderIsEmptyElement(reader) ? NULL : xmlTextReaderReadString(reader);
             if (data == NULL)
+            {
+                delete geometry;
                 throw XAO_Exception("Missing BREP");
+            }
             geometry->setShapeString((char*)data);
             xmlFree(data);
         }
     }
     else
     {
+        delete geometry;
         throw XAO_Exception(MsgBuilder() << "Shape format not supported: "
-                                         << XaoUtils::shapeFormatToString(geometry->getFormat()));
-    }
-  }
-
-  void parseTopologyNode(xmlNodePtr topologyNode, Geometry* geometry)
-  {
-    for (xmlNodePtr node = topologyNode->children; node; node = node->next)
-    {
-        if (xmlStrcmp(node->name, C_TAG_VERTICES) == 0)
-            parseVerticesNode(node, geometry);
-        else if (xmlStrcmp(node->name, C_TAG_EDGES) == 0)
-            parseEdgesNode(node, geometry);
-        else if (xmlStrcmp(node->name, C_TAG_FACES) == 0)
-            parseFacesNode(node, geometry);
-        else if (xmlStrcmp(node->name, C_TAG_SOLIDS) == 0)
-            parseSolidsNode(node, geometry);
+                                         << XaoUtils::shapeFormatToString(shapeFormat));
     }
+    return geometry;
   }
 
-  void parseVerticesNode(xmlNodePtr verticesNode, Geometry* geometry)
+  void parseTopologyNode(xmlTextReaderPtr reader, Geometry* geometry)
   {
-    int count = readIntegerProp(verticesNode, C_ATTR_COUNT, true, -1);
-    geometry->setCountVertices(count);
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
 
-    for (xmlNodePtr node = verticesNode->children; node; node = node->next)
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_VERTEX) == 0)
-        {
-            int index = readIntegerProp(node, C_ATTR_ELT_INDEX, true, -1);
-            std::string name = readStringProp(node, C_ATTR_ELT_NAME, false, "");
-            std::string reference = readStringProp(node, C_ATTR_ELT_REFERENCE, true, "");
-
-            geometry->setVertex(index, name, reference);
-        }
+        if (isNode(reader, C_TAG_VERTICES))
+            parseElementsNode(reader, geometry, XAO::VERTEX, C_TAG_VERTEX);
+        else if (isNode(reader, C_TAG_EDGES))
+            parseElementsNode(reader, geometry, XAO::EDGE, C_TAG_EDGE);
+        else if (isNode(reader, C_TAG_FACES))
+            parseElementsNode(reader, geometry, XAO::FACE, C_TAG_FACE);
+        else if (isNode(reader, C_TAG_SOLIDS))
+            parseElementsNode(reader, geometry, XAO::SOLID, C_TAG_SOLID);
     }
   }
 
-  void parseEdgesNode(xmlNodePtr edgesNode, Geometry* geometry)
+  void parseElementsNode(xmlTextReaderPtr reader, Geometry* geometry,
+                         XAO::Dimension dim, const xmlChar* eltTag)
   {
-    int count = readIntegerProp(edgesNode, C_ATTR_COUNT, true, -1);
-    geometry->setCountEdges(count);
-
-    for (xmlNodePtr node = edgesNode->children; node; node = node->next)
-    {
-        if (xmlStrcmp(node->name, C_TAG_EDGE) == 0)
-        {
-            int index = readIntegerProp(node, C_ATTR_ELT_INDEX, true, -1);
-            std::string name = readStringProp(node, C_ATTR_ELT_NAME, false, "");
-            std::string reference = readStringProp(node, C_ATTR_ELT_REFERENCE, true, "");
-
-            geometry->setEdge(index, name, reference);
-        }
-    }
-  }
+    int count = readIntegerProp(reader, C_ATTR_COUNT, true, -1);
+    if (dim == XAO::VERTEX)
+        geometry->setCountVertices(count);
+    else if (dim == XAO::EDGE)
+        geometry->setCountEdges(count);
+    else if (dim == XAO::FACE)
+        geometry->setCountFaces(count);
+    else
+        geometry->setCountSolids(count);
 
-  void parseFacesNode(xmlNodePtr facesNode, Geometry* geometry)
-  {
-    int count = readIntegerProp(facesNode, C_ATTR_COUNT, true, -1);
-    geometry->setCountFaces(count);
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
 
-    for (xmlNodePtr node = facesNode->children; node; node = node->next)
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_FACE) == 0)
+        if (isNode(reader, eltTag))
         {
-            int index = readIntegerProp(node, C_ATTR_ELT_INDEX, true, -1);
-            std::string name = readStringProp(node, C_ATTR_ELT_NAME, false, "");
-            std::string reference = readStringProp(node, C_ATTR_ELT_REFERENCE, true, "");
-
-            geometry->setFace(index, name, reference);
+            int index = readIntegerProp(reader, C_ATTR_ELT_INDEX, true, -1);
+            std::string name = readStringProp(reader, C_ATTR_ELT_NAME, false, "");
+            std::string reference = readStringProp(reader, C_ATTR_ELT_REFERENCE, true, "");
+
+            if (dim == XAO::VERTEX)
+                geometry->setVertex(index, name, reference);
+            else if (dim == XAO::EDGE)
+                geometry->setEdge(index, name, reference);
+            else if (dim == XAO::FACE)
+                geometry->setFace(index, name, reference);
+            else
+                geometry->setSolid(index, name, reference);
         }
     }
   }
 
-  void parseSolidsNode(xmlNodePtr solidsNode, Geometry* geometry)
+  void parseGroupsNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    int count = readIntegerProp(solidsNode, C_ATTR_COUNT, true, -1);
-    geometry->setCountSolids(count);
-
-    for (xmlNodePtr node = solidsNode->children; node; node = node->next)
-    {
-        if (xmlStrcmp(node->name, C_TAG_SOLID) == 0)
-        {
-            int index = readIntegerProp(node, C_ATTR_ELT_INDEX, true, -1);
-            std::string name = readStringProp(node, C_ATTR_ELT_NAME, false, "");
-            std::string reference = readStringProp(node, C_ATTR_ELT_REFERENCE, true, "");
-
-            geometry->setSolid(index, name, reference);
-        }
-    }
-  }
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
 
-  void parseGroupsNode(xmlNodePtr groupsNode, Xao* xaoObject)
-  {
-    for (xmlNodePtr node = groupsNode->children; node; node = node->next)
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_GROUP) == 0)
+        if (isNode(reader, C_TAG_GROUP))
         {
-            parseGroupNode(node, xaoObject);
+            parseGroupNode(reader, xaoObject);
         }
     }
   }
 
-  void parseGroupNode(xmlNodePtr groupNode, Xao* xaoObject)
+  void parseGroupNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    std::string strDimension = readStringProp(groupNode, C_ATTR_GROUP_DIM, true, "");
+    std::string strDimension = readStringProp(reader, C_ATTR_GROUP_DIM, true, "");
     XAO::Dimension dim = XaoUtils::stringToDimension(strDimension);
     Group* group = xaoObject->addGroup(dim);
 
-    std::string name = readStringProp(groupNode, C_ATTR_GROUP_NAME, false, "");
+    std::string name = readStringProp(reader, C_ATTR_GROUP_NAME, false, "");
     group->setName(name);
 
-    for (xmlNodePtr node = groupNode->children; node; node = node->next)
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
+
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_ELEMENT) == 0)
+        if (isNode(reader, C_TAG_ELEMENT))
         {
-            int index = readIntegerProp(node, C_ATTR_ELEMENT_INDEX, true, -1);
+            int index = readIntegerProp(reader, C_ATTR_ELEMENT_INDEX, true, -1);
             group->add(index);
         }
     }
   }
 
-  void parseFieldsNode(xmlNodePtr fieldsNode, Xao* xaoObject)
+  void parseFieldsNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    for (xmlNodePtr node = fieldsNode->children; node; node = node->next)
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
+
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(node->name, C_TAG_FIELD) == 0)
+        if (isNode(reader, C_TAG_FIELD))
         {
-            parseFieldNode(node, xaoObject);
+            parseFieldNode(reader, xaoObject);
         }
     }
   }
 
-  void parseFieldNode(xmlNodePtr fieldNode, Xao* xaoObject)
+  void parseFieldNode(xmlTextReaderPtr reader, Xao* xaoObject)
   {
-    std::string strDimension = readStringProp(fieldNode, C_ATTR_FIELD_DIMENSION, true, "");
+    std::string strDimension = readStringProp(reader, C_ATTR_FIELD_DIMENSION, true, "");
     XAO::Dimension dim = XaoUtils::stringToDimension(strDimension);
 
-    std::string strType = readStringProp(fieldNode, C_ATTR_FIELD_TYPE, true, "");
+    std::string strType = readStringProp(reader, C_ATTR_FIELD_TYPE, true, "");
     XAO::Type type = XaoUtils::stringToFieldType(strType);
 
-    // we need to get the number of components first to create the field
-    xmlNodePtr componentsNode = NULL;
-    xmlNodePtr stepsNode = NULL;
-
-    for (xmlNodePtr node = fieldNode->children; node; node = node->next)
-    {
-        if (xmlStrcmp(node->name, C_TAG_COMPONENTS) == 0)
-            componentsNode = node;
-        else if (xmlStrcmp(node->name, C_TAG_STEPS) == 0)
-            stepsNode = node;
-    }
-
-    // ensure that the components node is defined
-    if (componentsNode == NULL)
-    {
-        throw XAO_Exception(MsgBuilder() << "Line " << fieldNode->line << ": "
-                                         << "No components defined for field.");
-    }
-
-    // create the field
-    int nbComponents = readIntegerProp(componentsNode, C_ATTR_COUNT, true, -1);
-    Field* field = xaoObject->addField(type, dim, nbComponents);
-
-    // parse the components
-    for (xmlNodePtr compNode = componentsNode->children; compNode; compNode = compNode->next)
-    {
-        std::string compName= readStringProp(compNode, C_ATTR_COMPONENT_NAME, false, "");
-        if (compName.size() > 0)
-        {
-            int col = readIntegerProp(compNode, C_ATTR_COMPONENT_COLUMN, true, -1);
-            field->setComponentName(col, compName);
-        }
-    }
-
-    // set the name
-    std::string name = readStringProp(fieldNode, C_ATTR_FIELD_NAME, false, "");
-    if (name.size() > 0) field->setName(name);
+    std::string name = readStringProp(reader, C_ATTR_FIELD_NAME, false, "");
+    int line = xmlTextReaderGetParserLineNumber(reader);
 
-    // read the steps
-    if (stepsNode != 0)
+    // the components are written before the steps, their number is needed to create the field:
+    // the steps met before the components are kept until the field is created
+    Field* field = NULL;
+    std::list<StepData> pendingSteps;
+    if (!xmlTextReaderIsEmptyElement(reader))
     {
-        for (xmlNodePtr stepNode = stepsNode->children; stepNode; stepNode = stepNode->next)
+        int depth = xmlTextReaderDepth(reader);
+        while (readNextChild(reader, depth))
         {
-            if (xmlStrcmp(stepNode->name, C_TAG_STEP) == 0)
+            if (isNode(reader, C_TAG_COMPONENTS) && field == NULL)
             {
-                parseStepNode(stepNode, field);
+                // create the field
+                int nbComponents = readIntegerProp(reader, C_ATTR_COUNT, true, -1);
+                field = xaoObject->addField(type, dim, nbComponents);
+                // set the name
+                if (name.size() > 0) field->setName(name);
+
+                // parse the components
+                if (xmlTextReaderIsEmptyElement(reader))
+                    continue;
+                int compDepth = xmlTextReaderDepth(reader);
+                while (readNextChild(reader, compDepth))
+                {
+                    std::string compName = readStringProp(reader, C_ATTR_COMPONENT_NAME, false, "");
+                    if (compName.size() > 0)
+                    {
+                        int col = readIntegerProp(reader, C_ATTR_COMPONENT_COLUMN, true, -1);
+                        field->setComponentName(col, compName);
+                    }
+                }
+
+                for (std::list<StepData>::iterator it = pendingSteps.begin(); it != pendingSteps.end(); ++it)
+                    applyStep(field, *it);
+                pendingSteps.clear();
+            }
+            else if (isNode(reader, C_TAG_STEPS))
+            {
+                // read the steps
+                if (xmlTextReaderIsEmptyElement(reader))
+                    continue;
+                StepData data;
+                int stepsDepth = xmlTextReaderDepth(reader);
+                while (readNextChild(reader, stepsDepth))
+                {
+                    if (isNode(reader, C_TAG_STEP))
+                    {
+                        if (field == NULL)
+                        {
+                            pendingSteps.push_back(StepData());
+                            parseStepNode(reader, type, pendingSteps.back());
+                        }
+                        else
+                        {
+                            parseStepNode(reader, type, data);
+                            applyStep(field, data);
+                        }
+                    }
+                }
             }
         }
     }
-  }
-
-  void parseStepNode(xmlNodePtr stepNode, Field* field)
-  {
-    int stepNumber = readIntegerProp(stepNode, C_ATTR_STEP_NUMBER, true, -1);
-    Step* step = field->addNewStep(stepNumber);
 
-    int stepStamp = readIntegerProp(stepNode, C_ATTR_STEP_STAMP, false, -1);
-    if (stepStamp != -1)
+    // ensure that the components node is defined
+    if (field == NULL)
     {
-        step->setStamp(stepStamp);
+        throw XAO_Exception(MsgBuilder() << "Line " << line << ": "
+                                         << "No components defined for field.");
     }
+  }
 
-    for (xmlNodePtr eltNode = stepNode->children; eltNode; eltNode = eltNode->next)
+  void parseStepNode(xmlTextReaderPtr reader, XAO::Type type, StepData& data)
+  {
+    data.number = readIntegerProp(reader, C_ATTR_STEP_NUMBER, true, -1);
+    data.stamp = readIntegerProp(reader, C_ATTR_STEP_STAMP, false, -1);
+    data.elements.clear();
+    data.components.clear();
+    data.doubles.clear();
+    data.integers.clear();
+    data.strings.clear();
+
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
+
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(eltNode->name, C_TAG_ELEMENT) == 0)
+        if (isNode(reader, C_TAG_ELEMENT))
         {
-            parseStepElementNode(eltNode, step);
+            parseStepElementNode(reader, type, data);
         }
     }
   }
 
-  void parseStepElementNode(xmlNodePtr eltNode, Step* step)
+  void parseStepElementNode(xmlTextReaderPtr reader, XAO::Type type, StepData& data)
   {
-    int index = readIntegerProp(eltNode, C_ATTR_ELT_INDEX, true, -1);
+    int index = readIntegerProp(reader, C_ATTR_ELT_INDEX, true, -1);
+
+    if (xmlTextReaderIsEmptyElement(reader))
+        return;
 
-    for (xmlNodePtr valNode = eltNode->children; valNode; valNode = valNode->next)
+    // numbers are parsed in the classic locale (see exportStep); the stream is reused
+    std::istringstream convert;
+    convert.imbue(std::locale::classic());
+    int depth = xmlTextReaderDepth(reader);
+    while (readNextChild(reader, depth))
     {
-        if (xmlStrcmp(valNode->name, C_TAG_VALUE) == 0)
+        if (isNode(reader, C_TAG_VALUE))
         {
-            int component = readIntegerProp(valNode, C_ATTR_VALUE_COMPONENT, true, -1);
-            xmlChar* data = xmlNodeGetContent(valNode->children);
+            int component = readIntegerProp(reader, C_ATTR_VALUE_COMPONENT, true, -1);
+            xmlChar* content = xmlTextReaderIsEmptyElement(reader) ? NULL : xmlTextReaderReadString(reader);
+            const char* value = content != NULL ? (const char*)content : "";
+            if (*value == 0 && type != XAO::STRING)
+            {
+                xmlFree(content);
+                throw XAO_Exception(MsgBuilder() << "Line " << xmlTextReaderGetParserLineNumber(reader)
+                                                 << ": no content for value.");
+            }
 
-            std::string value;
-            if (data != NULL)
+            // the text is converted to the type of the field in place: the whole text must be
+            // the value (spaces around are allowed)
+            bool isValid = true;
+            if (type == XAO::DOUBLE || type == XAO::INTEGER)
             {
-                value = (char*)data;
+                convert.clear();
+                convert.str(value);
+                if (type == XAO::DOUBLE)
+                {
+                    double number;
+                    isValid = !(convert >> number).fail();
+                    data.doubles.push_back(number);
+                }
+                else
+                {
+                    int number;
+                    isValid = !(convert >> number).fail();
+                    data.integers.push_back(number);
+                }
+                isValid = isValid && (convert >> std::ws).eof();
             }
-            else if (step->getType() != XAO::STRING)
+            else if (type == XAO::BOOLEAN)
             {
-                throw XAO_Exception(MsgBuilder() << "Line " << valNode->line << ": no content for value.");
+                if (strcmp(value, "true") == 0 || strcmp(value, "1") == 0)
+                    data.integers.push_back(1);
+                else if (strcmp(value, "false") == 0 || strcmp(value, "0") == 0)
+                    data.integers.push_back(0);
+                else
+                    isValid = false;
             }
+            else
+            {
+                data.strings.push_back(value);
+            }
+            if (!isValid)
+            {
+                MsgBuilder msg;
+                msg << "Line " << xmlTextReaderGetParserLineNumber(reader) << ": "
+                    << "Invalid value: " << value;
+                xmlFree(content);
+                throw XAO_Exception(msg);
+            }
+            xmlFree(content);
 
-            step->setStringValue(index, component, value);
+            data.elements.push_back(index);
+            data.components.push_back(component);
         }
     }
   }
+
+  void applyStep(Field* field, const StepData& data)
+  {
+    Step* step = field->addNewStep(data.number);
+    if (data.stamp != -1)
+    {
+        step->setStamp(data.stamp);
+    }
+
+    int nbValues = (int)data.elements.size();
+    switch (field->getType())
+    {
+    case XAO::DOUBLE:
+        for (int i = 0; i < nbValues; ++i)
+            ((DoubleStep*)step)->setValue(data.elements[i], data.components[i], data.doubles[i]);
+        break;
+    case XAO::INTEGER:
+        for (int i = 0; i < nbValues; ++i)
+            ((IntegerStep*)step)->setValue(data.elements[i], data.components[i], data.integers[i]);
+        break;
+    case XAO::BOOLEAN:
+        for (int i = 0; i < nbValues; ++i)
+            ((BooleanStep*)step)->setValue(data.elements[i], data.components[i], data.integers[i] != 0);
+        break;
+    default:
+        for (int i = 0; i < nbValues; ++i)
+            ((StringStep*)step)->setValue(data.elements[i], data.components[i], data.strings[i]);
+        break;
+    }
+  }
 }
 
 bool XaoExporter::saveToFile(Xao* xaoObject, const std::string& fileName, const std::string& shapeFileName)
 
 {
-    xmlDocPtr doc = exportXMLDoc(xaoObject, shapeFileName);
-    xmlSaveFormatFileEnc(fileName.c_str(), doc, "UTF-8", 1); // format = 1 for node indentation
-    xmlFreeDoc(doc);
+    // the document is written while the data is traversed, without building of the DOM
+    xmlTextWriterPtr writer = xmlNewTextWriterFilename(fileName.c_str(), 0);
+    if (writer == NULL)
+        throw XAO_Exception(MsgBuilder() << "Cannot write XAO file: " << fileName);
+
+    try
+    {
+        exportXML(writer, xaoObject, shapeFileName);
+    }
+    catch (...)
+    {
+        xmlFreeTextWriter(writer);
+        throw;
+    }
+    xmlFreeTextWriter(writer);
 
     return true;
 }
@@ -651,31 +882,55 @@ bool XaoExporter::saveToFile(Xao* xaoObject, const std::string& fileName, const
 const std::string XaoExporter::saveToXml(Xao* xaoObject)
 
 {
-    xmlDocPtr doc = exportXMLDoc(xaoObject, "");
+    xmlBufferPtr buffer = xmlBufferCreate();
+    // avoid reallocation of the whole buffer on each write
+    xmlBufferSetAllocationScheme(buffer, XML_BUFFER_ALLOC_DOUBLEIT);
+    xmlTextWriterPtr writer = xmlNewTextWriterMemory(buffer, 0);
+    if (writer == NULL)
+    {
+        xmlBufferFree(buffer);
+        throw XAO_Exception("Cannot write XAO stream");
+    }
 
-    xmlChar *xmlbuff;
-    int buffersize;
-    //xmlDocDumpFormatMemory(doc, &xmlbuff, &buffersize, 1); // format = 1 for node indentation
-    // save with encoding to correspond to "saveToFile" and provide the same file size
-    xmlDocDumpFormatMemoryEnc(doc, &xmlbuff, &buffersize, "UTF-8", 1); // format = 1 for node indentation
-    xmlFreeDoc(doc);
-    xmlCleanupGlobals();
+    try
+    {
+        exportXML(writer, xaoObject, "");
+    }
+    catch (...)
+    {
+        xmlFreeTextWriter(writer);
+        xmlBufferFree(buffer);
+        throw;
+    }
+    // flushes the writer to the buffer
+    xmlFreeTextWriter(writer);
 
-    return (char*)xmlbuff;
+    std::string res((const char*)xmlBufferContent(buffer), xmlBufferLength(buffer));
+    xmlBufferFree(buffer);
+    return res;
 }
 
 bool XaoExporter::readFromFile(const std::string& fileName, Xao* xaoObject)
 
 {
-    // parse the file and get the DOM
+    // the file is parsed while it is read, without building of the DOM
     int options = XML_PARSE_HUGE | XML_PARSE_NOCDATA;
-    xmlDocPtr doc = xmlReadFile(fileName.c_str(), NULL, options);
-    if (doc == NULL)
+    xmlTextReaderPtr reader = xmlReaderForFile(fileName.c_str(), NULL, options);
+    if (reader == NULL)
     {
         throw XAO_Exception("Cannot read XAO file");
     }
 
-    parseXMLDoc(doc, xaoObject);
+    try
+    {
+        parseXML(reader, xaoObject);
+    }
+    catch (...)
+    {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+    xmlFreeTextReader(reader);
     return true;
 }
 
@@ -683,12 +938,21 @@ bool XaoExporter::setXML(const std::string& xml, Xao* xaoObject)
 
 {
     int options = XML_PARSE_HUGE | XML_PARSE_NOCDATA;
-    xmlDocPtr doc = xmlReadDoc(BAD_CAST xml.c_str(), "", NULL, options);
-    if (doc == NULL)
+    xmlTextReaderPtr reader = xmlReaderForMemory(xml.c_str(), (int)xml.size(), "", NULL, options);
+    if (reader == NULL)
     {
         throw XAO_Exception("Cannot read XAO stream");
     }
 
-    parseXMLDoc(doc, xaoObject);
+    try
+    {
+        parseXML(reader, xaoObject);
+    }
+    catch (...)
+    {
+        xmlFreeTextReader(reader);
+        throw;
+    }
+    xmlFreeTextReader(reader);
     return true;
 }
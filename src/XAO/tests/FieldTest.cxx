@@ -398,7 +398,22 @@ void FieldTest::testDoubleStepValues()
     // all values
     for (int i = 1; i < nbElements*nbComponents; ++i)
         allValues.push_back(1.1);
-    step->setValues(allValues);}
+    step->setValues(allValues);
+
+    // values without copy
+    const std::vector<double>& rawValues = step->getRawValues();
+    CPPUNIT_ASSERT_EQUAL(nbElements*nbComponents, (int)rawValues.size());
+    CPPUNIT_ASSERT_EQUAL(1.1, rawValues[7]);
+
+    // set all values from a buffer
+    std::vector<double> buffer(nbElements*nbComponents);
+    for (int i = 0; i < nbElements*nbComponents; ++i)
+        buffer[i] = i*0.5;
+    CPPUNIT_ASSERT_THROW(step->setValues(&buffer[0], 1), XAO_Exception);
+    step->setValues(&buffer[0], nbElements*nbComponents);
+    CPPUNIT_ASSERT_EQUAL(3.5, step->getValue(2, 1));
+    CPPUNIT_ASSERT_EQUAL(3.5, rawValues[7]);
+}
 
 void FieldTest::testStringStepValues()
 {
@@ -106,9 +106,25 @@ void GeometryTest::testGeometryElementList()
     CPPUNIT_ASSERT_EQUAL(8, otherLst.getIndexByReference("R8"));
     CPPUNIT_ASSERT_THROW(otherLst.getIndexByReference("ZZ"), XAO_Exception);
 
+    // ---- change references after the first search
+    otherLst.setReference(8, "R88");
+    CPPUNIT_ASSERT_EQUAL(8, otherLst.getIndexByReference("R88"));
+    CPPUNIT_ASSERT_THROW(otherLst.getIndexByReference("R8"), XAO_Exception);
+    otherLst.setReference(2, "R5");
+    CPPUNIT_ASSERT_EQUAL(2, otherLst.getIndexByReference("R5"));
+    otherLst.setReference(2, "R2");
+    CPPUNIT_ASSERT_EQUAL(5, otherLst.getIndexByReference("R5"));
+    otherLst.setReference(8, "R8");
+
     GeometricElementList::iterator first = otherLst.begin();
     GeometricElement firstElt = first->second;
     CPPUNIT_ASSERT_EQUAL(std::string("R0"),  firstElt.getReference());
+
+    // ---- change a reference through the iterator
+    first->second.setReference("R00");
+    CPPUNIT_ASSERT_EQUAL(0, otherLst.getIndexByReference("R00"));
+    CPPUNIT_ASSERT_THROW(otherLst.getIndexByReference("R0"), XAO_Exception);
+    CPPUNIT_ASSERT_EQUAL(9, otherLst.getIndexByReference("R9"));
 }
 
 void GeometryTest::testGeometry()
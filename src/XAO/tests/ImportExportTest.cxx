@@ -26,6 +26,9 @@
 #include "../XAO_Field.hxx"
 #include "../XAO_IntegerField.hxx"
 #include "../XAO_IntegerStep.hxx"
+#include "../XAO_DoubleField.hxx"
+#include "../XAO_DoubleStep.hxx"
+
 
 using namespace XAO;
 
@@ -135,6 +138,122 @@ void ImportExportTest::testImportXaoFromText()
     checkImport(xao);
 }
 
+void ImportExportTest::testLargeField()
+{
+    // synthetic field big enough to measure the export and the import of the values
+    const int nbFaces = 50000;
+    const int nbSteps = 4;
+
+    Xao xao("me", "1.0");
+    Geometry* geom = Geometry::createGeometry(XAO::BREP);
+    geom->setName("large");
+    geom->setCountFaces(nbFaces);
+    for (int i = 0; i < nbFaces; ++i)
+        geom->setFace(i, "", XaoUtils::intToString(i + 1));
+    xao.setGeometry(geom);
+
+    DoubleField* field = (DoubleField*)xao.addField(XAO::DOUBLE, XAO::FACE, 3, "displacement");
+    for (int stepIndex = 0; stepIndex < nbSteps; ++stepIndex)
+    {
+        DoubleStep* dstep = field->addStep(stepIndex, stepIndex);
+        for (int eltIndex = 0; eltIndex < nbFaces; ++eltIndex)
+        {
+            for (int compIndex = 0; compIndex < 3; ++compIndex)
+                dstep->setValue(eltIndex, compIndex, stepIndex + eltIndex * 0.5 + compIndex);
+        }
+    }
+
+    std::string xml = xao.getXML();
+
+    Xao other;
+    other.setXML(xml);
+
+    CPPUNIT_ASSERT_EQUAL(nbFaces, other.getGeometry()->countFaces());
+    CPPUNIT_ASSERT_EQUAL(std::string("7"), other.getGeometry()->getFaceReference(6));
+    CPPUNIT_ASSERT_EQUAL(1, other.countFields());
+
+    Field* otherField = other.getField(0);
+    CPPUNIT_ASSERT_EQUAL(std::string("displacement"), otherField->getName());
+    CPPUNIT_ASSERT_EQUAL(nbSteps, otherField->countSteps());
+    DoubleStep* lastStep = (DoubleStep*)*(otherField->end() - 1);
+    CPPUNIT_ASSERT_EQUAL(nbSteps - 1, lastStep->getStep());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(nbSteps - 1 + (nbFaces - 1) * 0.5 + 2,
+                                 lastStep->getValue(nbFaces - 1, 2), 1e-9);
+}
+
+void ImportExportTest::testStepsBeforeComponents()
+{
+    Xao xao("me", "1.0");
+    Geometry* geom = Geometry::createGeometry(XAO::BREP);
+    geom->setName("mygeom");
+    geom->setCountFaces(2);
+    geom->setFace(0, "", "1");
+    geom->setFace(1, "", "2");
+    xao.setGeometry(geom);
+
+    IntegerField* field = (IntegerField*)xao.addField(XAO::INTEGER, XAO::FACE, 2, "color");
+    field->setComponentName(1, "green");
+    IntegerStep* istep = field->addStep(3, 30);
+    istep->setValue(1, 1, 7);
+
+    // move the steps before the components, the order of the children is free
+    std::string xml = xao.getXML();
+    size_t compPos = xml.find("<components");
+    size_t stepsPos = xml.find("<steps");
+    size_t stepsEnd = xml.find("</steps>") + 8;
+    CPPUNIT_ASSERT(compPos < stepsPos && stepsEnd > stepsPos);
+    std::string steps = xml.substr(stepsPos, stepsEnd - stepsPos);
+    xml.erase(stepsPos, stepsEnd - stepsPos);
+    xml.insert(compPos, steps);
+
+    Xao other;
+    other.setXML(xml);
+    CPPUNIT_ASSERT_EQUAL(1, other.countFields());
+    Field* otherField = other.getField(0);
+    CPPUNIT_ASSERT_EQUAL(2, otherField->countComponents());
+    CPPUNIT_ASSERT_EQUAL(std::string("green"), otherField->getComponentName(1));
+    CPPUNIT_ASSERT_EQUAL(1, otherField->countSteps());
+    IntegerStep* otherStep = (IntegerStep*)*otherField->begin();
+    CPPUNIT_ASSERT_EQUAL(3, otherStep->getStep());
+    CPPUNIT_ASSERT_EQUAL(30, otherStep->getStamp());
+    CPPUNIT_ASSERT_EQUAL(7, otherStep->getValue(1, 1));
+}
+
+void ImportExportTest::testStepValues()
+{
+    Xao xao("me", "1.0");
+    Geometry* geom = Geometry::createGeometry(XAO::BREP);
+    geom->setName("mygeom");
+    geom->setCountFaces(2);
+    geom->setFace(0, "", "1");
+    geom->setFace(1, "", "2");
+    xao.setGeometry(geom);
+
+    DoubleField* field = (DoubleField*)xao.addField(XAO::DOUBLE, XAO::FACE, 1, "temperature");
+    DoubleStep* dstep = field->addStep(0);
+    dstep->setValue(0, 0, 0.5);
+    dstep->setValue(1, 0, -1250.25);
+
+    std::string xml = xao.getXML();
+    Xao other;
+    other.setXML(xml);
+    DoubleStep* otherStep = (DoubleStep*)*other.getField(0)->begin();
+    CPPUNIT_ASSERT_EQUAL(0.5, otherStep->getValue(0, 0));
+    CPPUNIT_ASSERT_EQUAL(-1250.25, otherStep->getValue(1, 0));
+
+    // a value followed by not numeric characters is rejected
+    size_t valuePos = xml.find(">0.5<");
+    CPPUNIT_ASSERT(valuePos != std::string::npos);
+    std::string invalid = xml;
+    invalid.replace(valuePos, 5, ">0.5abc<");
+    Xao invalidXao;
+    CPPUNIT_ASSERT_THROW(invalidXao.setXML(invalid), XAO_Exception);
+    // the decimal comma of some locales is not accepted
+    invalid = xml;
+    invalid.replace(valuePos, 5, ">0,5<");
+    CPPUNIT_ASSERT_THROW(invalidXao.setXML(invalid), XAO_Exception);
+}
+
 void ImportExportTest::checkImport(Xao& xao)
 {
     CPPUNIT_ASSERT_EQUAL(std::string("me"), xao.getAuthor());
@@ -34,6 +34,9 @@ namespace XAO
         CPPUNIT_TEST(testGeometryError);
         CPPUNIT_TEST(testImportXao);
         CPPUNIT_TEST(testImportXaoFromText);
+        CPPUNIT_TEST(testLargeField);
+        CPPUNIT_TEST(testStepsBeforeComponents);
+        CPPUNIT_TEST(testStepValues);
         CPPUNIT_TEST_SUITE_END();
 
     public:
@@ -46,6 +49,9 @@ namespace XAO
         void testGeometryError();
         void testImportXao();
         void testImportXaoFromText();
+        void testLargeField();
+        void testStepsBeforeComponents();
+        void testStepValues();
 
         void checkImport(Xao& xao);
     };
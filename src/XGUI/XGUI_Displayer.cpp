@@ -92,7 +92,9 @@
 #include <Events_Loop.h>
 #include <ModelAPI_Events.h>
 #include <Config_PropManager.h>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 #include <set>
 
@@ -338,6 +340,33 @@ bool XGUI_Displayer::erase(ObjectPtr theObject, const bool theUpdateViewer)
 
 //**************************************************************
 bool XGUI_Displayer::redisplay(ObjectPtr theObject, bool theUpdateViewer)
+{
+  bool aRedisplayed = redisplayObject(theObject);
+  if (aRedisplayed) {
+    myWorkshop->updateGroupsText();
+    if (theUpdateViewer)
+      updateViewer();
+  }
+  return aRedisplayed;
+}
+
+//**************************************************************
+bool XGUI_Displayer::redisplay(const std::set<ObjectPtr>& theObjects, bool theUpdateViewer)
+{
+  bool aRedisplayed = false;
+  std::set<ObjectPtr>::const_iterator anIt = theObjects.cbegin();
+  for (; anIt != theObjects.cend(); anIt++)
+    aRedisplayed = redisplayObject(*anIt) || aRedisplayed;
+  if (aRedisplayed) {
+    myWorkshop->updateGroupsText();
+    if (theUpdateViewer)
+      updateViewer();
+  }
+  return aRedisplayed;
+}
+
+//**************************************************************
+bool XGUI_Displayer::redisplayObject(ObjectPtr theObject)
 {
   bool aRedisplayed = false;
   Handle(AIS_InteractiveContext) aContext = AISContext();
@@ -359,11 +388,11 @@ bool XGUI_Displayer::redisplay(ObjectPtr theObject, bool theUpdateViewer)
     }
     AISObjectPtr aAIS_Obj = aPrs->getAISObject(aAISObj);
     if (!aAIS_Obj) {
-      aRedisplayed = erase(theObject, theUpdateViewer);
+      aRedisplayed = erase(theObject, false);
       return aRedisplayed;
     }
     if (aAIS_Obj != aAISObj) {
-      erase(theObject, theUpdateViewer);
+      erase(theObject, false);
       appendResultObject(theObject, aAIS_Obj);
     }
     aAISIO = aAIS_Obj->impl<Handle(AIS_InteractiveObject)>();
@@ -391,10 +420,20 @@ bool XGUI_Displayer::redisplay(ObjectPtr theObject, bool theUpdateViewer)
 
       if (!aColoredShapes.empty() && !aResPrsShape.IsNull())
       {
+        // index the sub-shapes once instead of exploring the shape for each colored one
+        TopTools_IndexedMapOfShape aSubShapes;
+        TopExp::MapShapes(aAISObj->getShape()->impl<TopoDS_Shape>(), aSubShapes);
         for (std::map<GeomShapePtr, std::vector<int>>::const_iterator anIter(aColoredShapes.cbegin());
           anIter != aColoredShapes.cend(); ++anIter)
         {
-          if (aAISObj->getShape()->isSubShape(anIter->first))
+          if (!anIter->first.get())
+            continue;
+          // the map is searched by IsSame, but the sub-shape must have the same orientation:
+          // the map keeps one orientation only, so, the other one is searched by exploring
+          const TopoDS_Shape& aColoredShape = anIter->first->impl<TopoDS_Shape>();
+          int anIndex = aSubShapes.FindIndex(aColoredShape);
+          if (anIndex > 0 && (aSubShapes.FindKey(anIndex).IsEqual(aColoredShape) ||
+                              aAISObj->getShape()->isSubShape(anIter->first)))
           {
             Quantity_Color aColorQ(anIter->second.at(0) / 255.,
               anIter->second.at(1) / 255.,
@@ -452,9 +491,6 @@ bool XGUI_Displayer::redisplay(ObjectPtr theObject, bool theUpdateViewer)
     #ifdef DEBUG_FEATURE_REDISPLAY
       qDebug("  Redisplay happens");
     #endif
-    myWorkshop->updateGroupsText();
-    if (theUpdateViewer)
-      updateViewer();
   }
   return aRedisplayed;
 }
@@ -41,6 +41,8 @@
 #include <QObject>
 #include <QString>
 
+#include <set>
+
 class ModuleBase_ViewerPrs;
 class ModelAPI_Feature;
 class XGUI_SelectionActivate;
@@ -228,6 +230,13 @@ public:
   /// \return true if the object visibility state is changed
   bool redisplay(ObjectPtr theObject, bool theUpdateViewer = true);
 
+  /// Redisplay the shapes of the objects if they were displayed. Texts of groups and the viewer
+  /// are updated once for all objects
+  /// \param theObjects objects to redisplay
+  /// \param theUpdateViewer the parameter whether the viewer should be updated immediately
+  /// \return true if the visibility state of some object is changed
+  bool redisplay(const std::set<ObjectPtr>& theObjects, bool theUpdateViewer = true);
+
   /// Sends and flushes a signal to redisplay all visualized objects.
   void redisplayObjects();
 
@@ -431,6 +440,11 @@ signals:
                bool theUpdateViewer = true);
 
 private:
+  /// Redisplay the shape of the object if it was displayed, without update of the viewer
+  /// \param theObject an object instance
+  /// \return true if the object visibility state is changed
+  bool redisplayObject(ObjectPtr theObject);
+
   /// Update the object presentable properties such as color, lines width and other
   /// If the object is result with the color attribute value set, it is used,
   /// otherwise the customize is applied to the object's feature if it is a custom prs
@@ -2748,7 +2748,7 @@ void XGUI_Workshop::changeColor(const QMap<ResultPtr, QList<GeomShapePtr>>& theS
     }
   }
 
-  Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_TO_REDISPLAY));
+  // redisplay is flushed by the finish of the operation together with the updates
   aMgr->finishOperation();
   updateCommandStatus();
   myViewerProxy->update();
@@ -2806,7 +2806,7 @@ void XGUI_Workshop::changeAutoColor(const QMap<ResultPtr, QList<GeomShapePtr>>&
           break;
       }
 
-      Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_TO_REDISPLAY));
+      // redisplay is flushed by the finish of the operation together with the updates
       aMgr->finishOperation();
       updateCommandStatus();
       myViewerProxy->update();
@@ -2924,7 +2924,7 @@ void XGUI_Workshop::changeDeflection(const QObjectPtrList& theObjects)
       ModelAPI_Tools::setDeflection(aResult, aDeflection);
     }
   }
-  Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_TO_REDISPLAY));
+  // redisplay is flushed by the finish of the operation together with the updates
   aMgr->finishOperation();
   updateCommandStatus();
 }
@@ -3231,6 +3231,7 @@ void XGUI_Workshop::setDisplayMode(const QObjectPtrList& theList, int theMode)
 //**************************************************************
 void XGUI_Workshop::toggleEdgesDirection(const QObjectPtrList& theList)
 {
+  std::set<ObjectPtr> aToRedisplay;
   foreach(ObjectPtr anObj, theList) {
     ResultPtr aResult = std::dynamic_pointer_cast<ModelAPI_Result>(anObj);
     if (aResult.get() != NULL)
@@ -3243,13 +3244,14 @@ void XGUI_Workshop::toggleEdgesDirection(const QObjectPtrList& theList)
         std::list<ResultPtr>::iterator aRes;
         for (aRes = allRes.begin(); aRes != allRes.end(); aRes++) {
           ModelAPI_Tools::showEdgesDirection(*aRes, aToShow);
-          myDisplayer->redisplay(*aRes, false);
+          aToRedisplay.insert(*aRes);
         }
       }
       ModelAPI_Tools::showEdgesDirection(aResult, aToShow);
-      myDisplayer->redisplay(anObj, false);
+      aToRedisplay.insert(anObj);
     }
   }
+  myDisplayer->redisplay(aToRedisplay, false);
   if (theList.size() > 0)
     myDisplayer->updateViewer();
 }
@@ -3258,15 +3260,17 @@ void XGUI_Workshop::toggleEdgesDirection(const QObjectPtrList& theList)
 void XGUI_Workshop::toggleBringToFront(const QObjectPtrList& theList)
 {
   // Toggle the "BringToFront" state of all objects in the list
+  std::set<ObjectPtr> aToRedisplay;
   foreach(ObjectPtr anObj, theList) {
     ResultPtr aResult = std::dynamic_pointer_cast<ModelAPI_Result>(anObj);
     if (aResult.get() != NULL)
     {
       bool aBringToFront = !ModelAPI_Tools::isBringToFront(aResult);
       ModelAPI_Tools::bringToFront(aResult, aBringToFront);
-      myDisplayer->redisplay(anObj, false);
+      aToRedisplay.insert(anObj);
     }
   }
+  myDisplayer->redisplay(aToRedisplay, false);
   if (theList.size() > 0)
     myDisplayer->updateViewer();
 }
@@ -3671,7 +3675,7 @@ void XGUI_Workshop::changeIsoLines(const QObjectPtrList& theObjects)
       ModelAPI_Tools::setIsoLines(aResult, aValues);
     }
     mySelector->clearSelection();
-    Events_Loop::loop()->flush(Events_Loop::eventByName(EVENT_OBJECT_TO_REDISPLAY));
+    // redisplay is flushed by the finish of the operation together with the updates
     aMgr->finishOperation();
     updateCommandStatus();
   }
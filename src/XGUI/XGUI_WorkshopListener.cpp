@@ -306,6 +306,7 @@ void XGUI_WorkshopListener::
   XGUI_Workshop* aWorkshop = workshop();
   XGUI_Displayer* aDisplayer = aWorkshop->displayer();
   bool aRedisplayed = false;
+  std::set<ObjectPtr> aToRedisplay; // visible objects are redisplayed together
   //std::list<ObjectPtr> aHiddenObjects;
   for (aIt = anObjects.begin(); aIt != anObjects.end(); ++aIt) {
     ObjectPtr aObj = (*aIt);
@@ -376,9 +377,7 @@ void XGUI_WorkshopListener::
           aRedisplayed = aDisplayer->erase(aObj, false) || aRedisplayed;
         }
         else {
-          aRedisplayed = aDisplayer->redisplay(aObj, false) || aRedisplayed;
-          // Deactivate object of current operation from selection
-          aWorkshop->deactivateActiveObject(aObj, false);
+          aToRedisplay.insert(aObj);
         }
       } else { // display object if the current operation has it
         if (displayObject(aObj)) {
@@ -390,6 +389,13 @@ void XGUI_WorkshopListener::
     }
   }
 
+  if (!aToRedisplay.empty()) {
+    aRedisplayed = aDisplayer->redisplay(aToRedisplay, false) || aRedisplayed;
+    // Deactivate objects of current operation from selection
+    for (aIt = aToRedisplay.begin(); aIt != aToRedisplay.end(); ++aIt)
+      aWorkshop->deactivateActiveObject(*aIt, false);
+  }
+
   // this processing should be moved in another place in order to do not cause problems in
   // flush messages chain
   //if (aHiddenObjects.size() > 0)